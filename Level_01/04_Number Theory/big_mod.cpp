@@ -1,21 +1,270 @@
 #include <iostream>
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+#include <vector>
+#include <algorithm>
 using namespace std;
+typedef unsigned long long ull;
+typedef unsigned __int128 u128;
+// a^b mod m without a single 64-bit % in the loop. Every product goes through
+// one of two reductions, picked once per modulus:
+//   m < 2^32      Barrett: x mod m from a precomputed 2^64 / m, one mulhi
+//   m odd         Montgomery form, valid for any odd m < 2^64
+//   m even        m = 2^k * odd: Montgomery mod odd, a mask mod 2^k, then CRT
+// Products are taken in unsigned __int128, so nothing overflows for 64-bit m.
+struct Barrett
+{
+    ull m, im; // im = floor((2^64 - 1) / m)
+    Barrett(ull m) : m(m), im(~0ULL / m) {}
+    ull reduce(ull x) const // x mod m for x < 2^64
+    {
+        ull q = ((u128)x * im) >> 64;
+        ull r = x - q * m;
+        return r >= m ? r - m : r;
+    }
+    ull mul(ull a, ull b) const { return reduce(a * b); } // a, b < m < 2^32
+};
+struct Montgomery
+{
+    ull n, nInv, r2; // nInv = n^-1 mod 2^64, r2 = 2^128 mod n
+    Montgomery(ull n = 1) : n(n)
+    {
+        nInv = n;
+        for (int i = 0; i < 5; i++)
+            nInv *= 2 - n * nInv;
+        ull r = -n % n;
+        r2 = (u128)r * r % n;
+    }
+    ull reduce(u128 x) const // x / 2^64 mod n
+    {
+        ull q = (ull)x * nInv;
+        ull m = ((u128)q * n) >> 64;
+        ull hi = x >> 64;
+        return hi >= m ? hi - m : hi + n - m;
+    }
+    ull to(ull a) const { return reduce((u128)(a % n) * r2); }
+    ull from(ull a) const { return reduce(a); }
+    ull mul(ull a, ull b) const { return reduce((u128)a * b); }
+};
+struct PowMod
+{
+    ull m, odd, mask; // m = odd * (mask + 1)
+    int kind;         // 0: m == 1, 1: Barrett, 2: Montgomery, 3: Montgomery + 2^k
+    Barrett br;
+    Montgomery mg;
+    ull oddInv; // odd^-1 mod 2^64, for the CRT step
+    PowMod(ull m) : m(m), br(m < (1ULL << 32) && m ? m : 1)
+    {
+        int k = __builtin_ctzll(m);
+        odd = m >> k;
+        mask = (1ULL << k) - 1;
+        if (m == 1)
+            kind = 0;
+        else if (m < (1ULL << 32))
+            kind = 1;
+        else
+        {
+            kind = (k == 0 ? 2 : 3);
+            if (odd > 1)
+                mg = Montgomery(odd);
+            oddInv = odd;
+            for (int i = 0; i < 5; i++)
+                oddInv *= 2 - odd * oddInv;
+        }
+    }
+    ull operator()(ull a, ull b) const
+    {
+        if (kind == 0)
+            return 0;
+        if (kind == 1)
+        {
+            ull x = br.reduce(a), res = 1;
+            for (; b; b >>= 1)
+            {
+                if (b & 1)
+                    res = br.mul(res, x);
+                x = br.mul(x, x);
+            }
+            return res;
+        }
+        ull r1 = 0;
+        if (odd > 1)
+        {
+            ull x = mg.to(a), res = mg.to(1);
+            for (ull e = b; e; e >>= 1)
+            {
+                if (e & 1)
+                    res = mg.mul(res, x);
+                x = mg.mul(x, x);
+            }
+            r1 = mg.from(res);
+        }
+        if (kind == 2)
+            return r1;
+        // mod 2^k every product just wraps, so plain 64-bit multiplies do
+        ull r2 = 1, x = a;
+        for (; b; b >>= 1)
+        {
+            if (b & 1)
+                r2 *= x;
+            x *= x;
+        }
+        r2 &= mask;
+        // x = r1 (mod odd), x = r2 (mod 2^k)
+        return r1 + odd * (((r2 - r1) * oddInv) & mask);
+    }
+};
 long long int big_mod(long long int a,long long int b,long long int m)
 {
-    if(b==0) return 1;
-    if(b%2==1)
+    if(b==0) return 1 % m;
+    a %= m;
+    if(a<0) a += m;
+    return PowMod(m)(a,b);
+}
+// base^e mod m for every base, with the modulus set up once
+vector<ull> pow_mod(const vector<ull> &bases, ull e, ull m)
+{
+    PowMod pw(m);
+    vector<ull> res(bases.size());
+    for(size_t i=0; i<bases.size(); i++)
     {
-       long long int x,y;
-       x = a%m;
-       y = big_mod(a,b-1,m);
-       return (x*y)%m;
+        res[i] = pw(bases[i],e);
     }
-    else if(b%2==0)
+    return res;
+}
+// Batch a[i]^b[i] mod m over SIMD lanes, one element per 64-bit lane, with
+// GCC vector types so the same code builds for AVX2 (W = 4), AVX-512 (W = 8)
+// and plain x86-64 SSE2 (W = 2). Each lane runs its own square-and-multiply; a lane whose
+// exponent bit is 0 keeps its old value. Odd m only; even m use PowMod.
+//   m < 2^32   Montgomery with R = 2^32, every product is one vpmuludq
+//   m < 2^64   Montgomery with R = 2^64, mulhi built from four 32x32 products
+typedef ull U2 __attribute__((vector_size(16)));
+typedef ull U4 __attribute__((vector_size(32)));
+typedef ull U8 __attribute__((vector_size(64)));
+#if defined(__AVX512F__)
+typedef U8 ULanes;
+#elif defined(__AVX2__)
+typedef U4 ULanes;
+#else
+typedef U2 ULanes;
+#endif
+// low 32 bits of each lane times low 32 bits of each lane, full 64-bit result.
+// Spelled as vpmuludq: left to itself GCC turns the masked product into a
+// 64x64 vpmullq on AVX-512, which is several times slower.
+template <typename V>
+V mul32(V a, V b)
+{
+    return (a & 0xFFFFFFFFULL) * (b & 0xFFFFFFFFULL);
+}
+#if defined(__SSE2__)
+template <>
+U2 mul32(U2 a, U2 b) { return (U2)_mm_mul_epu32((__m128i)a, (__m128i)b); }
+#endif
+#if defined(__AVX2__)
+template <>
+U4 mul32(U4 a, U4 b) { return (U4)_mm256_mul_epu32((__m256i)a, (__m256i)b); }
+#endif
+// GCC 12's avx512fintrin.h trips -Wuninitialized on its own _mm512_undefined;
+// silenced for the lane code only
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#if defined(__AVX512F__)
+template <>
+U8 mul32(U8 a, U8 b) { return (U8)_mm512_mul_epu32((__m512i)a, (__m512i)b); }
+#endif
+template <typename V>
+struct ModLanes
+{
+    static const int W = sizeof(V) / 8;
+    static V mulhi(V a, V b)
+    {
+        const ull M32 = 0xFFFFFFFFULL;
+        V a1 = a >> 32, b1 = b >> 32;
+        V p00 = mul32(a, b), p01 = mul32(a, b1), p10 = mul32(a1, b), p11 = mul32(a1, b1);
+        V mid = (p00 >> 32) + (p01 & M32) + (p10 & M32);
+        return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    }
+    // x / 2^32 mod m for x = hi:lo products of values below a 32-bit m
+    static V redc32(V x, ull m, ull mInv)
+    {
+        V q = mul32(x, (V){} + mInv);
+        V hi = x >> 32, qm = mul32(q, (V){} + m) >> 32;
+        return hi - qm + ((hi < qm) & m);
+    }
+    static V redc64(V a, V b, ull n, ull nInv)
+    {
+        V hi = mulhi(a, b), q = (a * b) * nInv, m = mulhi(q, (V){} + n);
+        return hi - m + ((hi < m) & n);
+    }
+    static void run(const ull *a, const ull *b, ull *out, size_t cnt, ull m)
     {
-        long long int result;
-        result = big_mod(a,b/2,m);
-        return (result * result) % m;
+        bool small = m < (1ULL << 32);
+        Montgomery mg(m);
+        ull inv32 = mg.nInv & 0xFFFFFFFFULL;                 // m^-1 mod 2^32
+        ull r32 = ((1ULL << 32) % m), r2_32 = r32 * r32 % m; // 2^32, 2^64 mod m
+        for (size_t s = 0; s < cnt; s += W)
+        {
+            V x, e, res;
+            ull maxE = 0;
+            for (int l = 0; l < W; l++)
+            {
+                size_t i = min(s + l, cnt - 1);
+                x[l] = a[i] % m;
+                e[l] = b[i];
+                maxE |= b[i];
+            }
+            if (small)
+            {
+                x = redc32(mul32(x, (V){} + r2_32), m, inv32);
+                res = (V){} + r32;
+                for (; maxE; maxE >>= 1, e >>= 1)
+                {
+                    V take = -(e & 1);
+                    res = (redc32(mul32(res, x), m, inv32) & take) | (res & ~take);
+                    x = redc32(mul32(x, x), m, inv32);
+                }
+                res = redc32(res, m, inv32);
+            }
+            else
+            {
+                x = redc64(x, (V){} + mg.r2, m, mg.nInv);
+                res = (V){} + mg.to(1);
+                for (; maxE; maxE >>= 1, e >>= 1)
+                {
+                    V take = -(e & 1);
+                    res = (redc64(res, x, m, mg.nInv) & take) | (res & ~take);
+                    x = redc64(x, x, m, mg.nInv);
+                }
+                res = redc64(res, (V){} + 1, m, mg.nInv);
+            }
+            for (int l = 0; l < W && s + l < cnt; l++)
+            {
+                out[s + l] = res[l];
+            }
+        }
     }
+};
+#pragma GCC diagnostic pop
+// a[i]^b[i] mod m for every i. The lanes only pay off where they beat one
+// scalar PowMod: SSE2's 2 lanes never do, and for m >= 2^32 each lane needs
+// four vpmuludq per mulhi, which takes the 8 lanes of AVX-512 to recover.
+vector<ull> pow_mod(const vector<ull> &a, const vector<ull> &b, ull m)
+{
+    vector<ull> res(a.size());
+    const int W = ModLanes<ULanes>::W;
+    if(m % 2 == 0 || m == 1 || W <= 2 || (m >= (1ULL << 32) && W <= 4))
+    {
+        PowMod pw(m);
+        for(size_t i=0; i<a.size(); i++)
+        {
+            res[i] = pw(a[i],b[i]);
+        }
+        return res;
+    }
+    ModLanes<ULanes>::run(a.data(), b.data(), res.data(), a.size(), m);
+    return res;
 }
 int main()
 {
@@ -27,4 +276,4 @@ int main()
         cout<<big_mod(a,b,m)<<endl;
     }
     return 0;
-}
\ No newline at end of file
+}
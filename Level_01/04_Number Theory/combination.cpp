@@ -1,18 +1,144 @@
 #include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
 
-// Function to calculate combinations (n choose r)
-double combinations(int n, int r) {
-    if (n < r) {
-        return 0; // Invalid input
+// Exact C(n, r) as a decimal string. The running product C(n - r + i, i) is
+// kept as base-1e9 limbs; each step multiplies by n - r + i and divides by i,
+// and the division is always exact. Meant for small n: O(r * digits).
+std::string binomialExact(unsigned n, unsigned r) {
+    if (r > n) {
+        return "0";
     }
+    r = std::min(r, n - r);
+    const uint32_t BASE = 1000000000;
+    std::vector<uint32_t> num = {1}; // least significant limb first
+    for (unsigned i = 1; i <= r; i++) {
+        uint64_t carry = 0;
+        for (uint32_t &limb : num) {
+            uint64_t cur = (uint64_t)limb * (n - r + i) + carry;
+            limb = cur % BASE;
+            carry = cur / BASE;
+        }
+        while (carry) {
+            num.push_back(carry % BASE);
+            carry /= BASE;
+        }
+        uint64_t rem = 0;
+        for (size_t k = num.size(); k-- > 0;) {
+            uint64_t cur = num[k] + rem * BASE;
+            num[k] = cur / i;
+            rem = cur % i;
+        }
+        while (num.size() > 1 && num.back() == 0) {
+            num.pop_back();
+        }
+    }
+    std::string out = std::to_string(num.back());
+    for (size_t k = num.size() - 1; k-- > 0;) {
+        std::string limb = std::to_string(num[k]);
+        out += std::string(9 - limb.size(), '0') + limb;
+    }
+    return out;
+}
 
-    double result = 1.0;
-    for (int i = 1; i <= r; i++) {
-        result *= (static_cast<double>(n - i + 1) / static_cast<double>(i));
+// C(n, r) mod a prime p < 2^32 from factorial and inverse-factorial tables.
+// The tables cover 0..N with N < p; only invFact[N] needs a modular inverse
+// (Fermat), the rest follow from invFact[i - 1] = invFact[i] * i. Products are
+// reduced with Barrett instead of %, so a table query is a few multiplies.
+// Queries with n >= p split n and r into base-p digits (Lucas' theorem).
+// A value or digit past the table is evaluated directly as
+// (n - r + 1) ... n / r! in O(min(r, n - r)), so N only trades memory for speed.
+class Binomial {
+public:
+    Binomial(uint32_t p, uint32_t N) : p(p), N(std::min<uint64_t>(N, p - 1)), im(~0ULL / p) {
+        fact.resize(this->N + 1);
+        invFact.resize(this->N + 1);
+        fact[0] = 1;
+        for (uint32_t i = 1; i <= this->N; i++) {
+            fact[i] = mul(fact[i - 1], i);
+        }
+        invFact[this->N] = power(fact[this->N], p - 2);
+        for (uint32_t i = this->N; i > 0; i--) {
+            invFact[i - 1] = mul(invFact[i], i);
+        }
     }
 
-    return result;
-}
+    // n, r <= N, O(1)
+    uint32_t small(uint32_t n, uint32_t r) const {
+        if (r > n) {
+            return 0;
+        }
+        return mul(mul(fact[n], invFact[r]), invFact[n - r]);
+    }
+
+    uint32_t operator()(uint64_t n, uint64_t r) const {
+        if (r > n) {
+            return 0;
+        }
+        if (n <= N) {
+            return small(n, r);
+        }
+        uint32_t res = 1;
+        while (n && res) {
+            uint64_t nd = n % p, rd = r % p;
+            res = mul(res, nd <= N ? small(nd, rd) : direct(nd, rd));
+            n /= p;
+            r /= p;
+        }
+        return res;
+    }
+
+    // out[i] = C(n[i], r[i]) mod p. Once the tables outgrow the cache every
+    // query is three random loads, so they are prefetched a few queries ahead.
+    void batch(const uint64_t *n, const uint64_t *r, uint32_t *out, size_t cnt) const {
+        const size_t AHEAD = 16;
+        for (size_t i = 0; i < cnt; i++) {
+            if (i + AHEAD < cnt && n[i + AHEAD] <= N && r[i + AHEAD] <= n[i + AHEAD]) {
+                __builtin_prefetch(&fact[n[i + AHEAD]]);
+                __builtin_prefetch(&invFact[r[i + AHEAD]]);
+                __builtin_prefetch(&invFact[n[i + AHEAD] - r[i + AHEAD]]);
+            }
+            out[i] = (n[i] <= N && r[i] <= n[i]) ? small(n[i], r[i]) : (*this)(n[i], r[i]);
+        }
+    }
+
+private:
+    uint32_t p, N;
+    uint64_t im; // floor((2^64 - 1) / p) for Barrett reduction
+    std::vector<uint32_t> fact, invFact;
+
+    uint32_t mul(uint32_t a, uint32_t b) const {
+        uint64_t x = (uint64_t)a * b;
+        uint64_t q = ((unsigned __int128)x * im) >> 64;
+        uint64_t res = x - q * p;
+        return res >= p ? res - p : res;
+    }
+    // C(n, r) for n < p without the tables
+    uint32_t direct(uint32_t n, uint32_t r) const {
+        if (r > n) {
+            return 0;
+        }
+        r = std::min(r, n - r);
+        uint32_t num = 1, den = 1;
+        for (uint32_t i = 1; i <= r; i++) {
+            num = mul(num, n - r + i);
+            den = mul(den, i);
+        }
+        return mul(num, power(den, p - 2));
+    }
+    uint32_t power(uint32_t a, uint32_t e) const {
+        uint32_t res = 1;
+        for (; e; e >>= 1) {
+            if (e & 1) {
+                res = mul(res, a);
+            }
+            a = mul(a, a);
+        }
+        return res;
+    }
+};
 
 int main() {
     int n, r;
@@ -23,9 +149,19 @@ int main() {
     std::cout << "Enter the value of r: ";
     std::cin >> r;
 
-    // Calculate and display the combination
-    double result = combinations(n, r);
-    std::cout << "C(" << n << ", " << r << ") = " << result << std::endl;
+    // Exact value for small n, and always the value mod 1e9 + 7. The tables
+    // stop at TABLE_MAX whatever n is; larger n are evaluated directly.
+    const uint32_t MOD = 1000000007;
+    const uint32_t TABLE_MAX = 1 << 20;
+    if (n < 0 || r < 0) {
+        std::cout << "C(" << n << ", " << r << ") = 0" << std::endl;
+        return 0;
+    }
+    if (n <= 100000) {
+        std::cout << "C(" << n << ", " << r << ") = " << binomialExact(n, r) << std::endl;
+    }
+    Binomial nCr(MOD, std::min<uint32_t>(n, TABLE_MAX));
+    std::cout << "C(" << n << ", " << r << ") mod " << MOD << " = " << nCr(n, r) << std::endl;
 
     return 0;
 }
@@ -1,26 +1,185 @@
 #include <iostream>
+#include <vector>
 using namespace std;
+typedef unsigned long long ull;
 
-int gcd(int a, int b, int &x, int &y)
+// Iterative extended Euclid: returns g = gcd(a, b) and x, y with a*x + b*y = g.
+// The loop keeps (r, x, y) for the last two remainders, so there is no
+// recursion and for |a|, |b| < 2^63 every value stays within 64 bits.
+long long ext_gcd(long long a, long long b, long long &x, long long &y)
 {
-    if (b == 0)
+    long long x0 = 1, y0 = 0, x1 = 0, y1 = 1;
+    while (b != 0)
+    {
+        long long q = a / b, t;
+        t = a - q * b, a = b, b = t;
+        t = x0 - q * x1, x0 = x1, x1 = t;
+        t = y0 - q * y1, y0 = y1, y1 = t;
+    }
+    if (a < 0)
     {
-        x = 1;
-        y = 0;
-        return a;
+        a = -a, x0 = -x0, y0 = -y0;
     }
-    int x1, y1;
-    int d = gcd(b, a % b, x1, y1);
-    x = y1;
-    y = x1 - y1 * (a / b);
+    x = x0;
+    y = y0;
+    return a;
+}
+int gcd(int a, int b, int &x, int &y)
+{
+    long long X, Y;
+    int d = ext_gcd(a, b, X, Y);
+    x = X;
+    y = Y;
     return d;
 }
+// a^-1 mod m for any m >= 1, or 0 when gcd(a, m) != 1 (and m > 1).
+// Euclid on unsigned values: the coefficients of a alternate in sign, so only
+// their magnitudes are kept (never above m) and the sign comes from the
+// number of steps. This stays exact for m up to 2^64 - 1.
+ull mod_inverse(ull a, ull m)
+{
+    ull r0 = m, r1 = a % m, x0 = 0, x1 = 1;
+    int steps = 0;
+    while (r1 != 0)
+    {
+        ull q = r0 / r1, t;
+        t = r0 - q * r1, r0 = r1, r1 = t;
+        t = x0 + q * x1, x0 = x1, x1 = t;
+        steps++;
+    }
+    if (r0 != 1)
+        return 0;
+    return steps % 2 == 1 ? x0 : (m - x0) % m;
+}
+// Modular products for the batch routines below, picked once per modulus as
+// in big_mod: Barrett for m < 2^32, Montgomery for odd m, and the plain
+// 128-bit % only for even m >= 2^32. Each reducer has the same interface:
+// to() and from() move a value in and out of its working form (identity
+// except for Montgomery), and mul() multiplies two values in that form.
+typedef unsigned __int128 u128;
+struct Barrett
+{
+    ull m, im; // im = floor((2^64 - 1) / m)
+    Barrett(ull m) : m(m), im(~0ULL / m) {}
+    ull reduce(ull x) const // x mod m for x < 2^64
+    {
+        ull q = ((u128)x * im) >> 64;
+        ull r = x - q * m;
+        return r >= m ? r - m : r;
+    }
+    ull to(ull a) const { return a; }
+    ull from(ull a) const { return a; }
+    ull mul(ull a, ull b) const { return reduce(a * b); } // a, b < m < 2^32
+};
+struct Montgomery
+{
+    ull n, nInv, r2; // nInv = n^-1 mod 2^64, r2 = 2^128 mod n
+    Montgomery(ull n) : n(n)
+    {
+        nInv = n;
+        for (int i = 0; i < 5; i++)
+            nInv *= 2 - n * nInv;
+        ull r = -n % n;
+        r2 = (u128)r * r % n;
+    }
+    ull reduce(u128 x) const // x / 2^64 mod n
+    {
+        ull q = (ull)x * nInv;
+        ull m = ((u128)q * n) >> 64;
+        ull hi = x >> 64;
+        return hi >= m ? hi - m : hi + n - m;
+    }
+    ull to(ull a) const { return reduce((u128)a * r2); } // a < n
+    ull from(ull a) const { return reduce(a); }
+    ull mul(ull a, ull b) const { return reduce((u128)a * b); }
+};
+struct Plain128
+{
+    ull m;
+    Plain128(ull m) : m(m) {}
+    ull to(ull a) const { return a; }
+    ull from(ull a) const { return a; }
+    ull mul(ull a, ull b) const { return (u128)a * b % m; }
+};
+// Runs f with the reducer that suits m
+template <typename F>
+auto withReducer(ull m, F f)
+{
+    if (m < (1ULL << 32))
+        return f(Barrett(m));
+    if (m % 2 == 1)
+        return f(Montgomery(m));
+    return f(Plain128(m));
+}
+// Montgomery's simultaneous inversion: with prefix products p[i] = a[0]...a[i],
+// one inverse of p[k-1] gives every a[i]^-1 walking back down:
+// a[i]^-1 = p[i-1] * p[i]^-1 and p[i-1]^-1 = p[i]^-1 * a[i]. That is one
+// extended gcd and 3(k - 1) multiplications for k inverses. If the product is
+// not invertible some a[i] shares a factor with m; then each element is
+// inverted on its own and those get 0.
+template <typename R>
+vector<ull> batch_inverse(const vector<ull> &a, ull m, const R &r)
+{
+    size_t k = a.size();
+    vector<ull> inv(k), prefix(k);
+    for (size_t i = 0; i < k; i++)
+    {
+        inv[i] = r.to(a[i] % m); // a[i] in working form until overwritten
+        prefix[i] = i ? r.mul(prefix[i - 1], inv[i]) : inv[i];
+    }
+    ull running = mod_inverse(r.from(prefix[k - 1]), m);
+    if (running == 0 && m > 1)
+    {
+        for (size_t i = 0; i < k; i++)
+        {
+            inv[i] = mod_inverse(a[i], m);
+        }
+        return inv;
+    }
+    running = r.to(running);
+    for (size_t i = k - 1; i > 0; i--)
+    {
+        ull ai = inv[i];
+        inv[i] = r.from(r.mul(running, prefix[i - 1]));
+        running = r.mul(running, ai);
+    }
+    inv[0] = r.from(running);
+    return inv;
+}
+vector<ull> batch_inverse(const vector<ull> &a, ull m)
+{
+    if (a.empty())
+        return {};
+    return withReducer(m, [&](const auto &r)
+                       { return batch_inverse(a, m, r); });
+}
+// inv[i] = i^-1 mod p for 1 <= i <= N < p, p prime, in O(N): from
+// p = (p / i) * i + p % i it follows that i^-1 = -(p / i) * (p % i)^-1.
+// The table is kept in the reducer's working form and converted at the end.
+vector<ull> inverse_table(ull N, ull p)
+{
+    vector<ull> inv(N + 1, 0);
+    if (N < 1)
+        return inv;
+    withReducer(p, [&](const auto &r)
+                {
+        inv[1] = r.to(1);
+        for (ull i = 2; i <= N; i++)
+        {
+            inv[i] = r.mul(r.to(p - p / i), inv[p % i]);
+        }
+        for (ull i = 1; i <= N; i++)
+        {
+            inv[i] = r.from(inv[i]);
+        } });
+    return inv;
+}
 int main()
 {
-    int a,b;
-    int x, y;
+    long long a,b;
+    long long x, y;
     cin>>a>>b;
-    int result = gcd(a, b, x, y);
+    long long result = ext_gcd(a, b, x, y);
 
     cout << "GCD of " << a << " and " << b << " is: " << result << endl;
     cout << "Coefficients x and y are: " << x << ", " << y << endl;
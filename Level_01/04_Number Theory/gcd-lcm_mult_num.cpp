@@ -1,13 +1,57 @@
 #include <bits/stdc++.h>
 using namespace std;
-int gcd(int a, int b)
+typedef unsigned long long ull;
+typedef unsigned __int128 u128;
+// Binary (Stein's) gcd: strip the common power of two once, then keep both
+// numbers odd and subtract the smaller from the larger. The swap compiles to
+// cmov, so the only branch is the loop itself.
+ull gcd64(ull a, ull b)
 {
-    if(b==0)
+    if(a==0 || b==0)
     {
-        return a;
+        return a | b;
     }
-    else
-    return gcd(b,a%b);
+    int shift = __builtin_ctzll(a | b);
+    a >>= __builtin_ctzll(a);
+    do
+    {
+        b >>= __builtin_ctzll(b);
+        ull lo = min(a, b), hi = max(a, b);
+        a = lo;
+        b = hi - lo;
+    } while(b);
+    return a << shift;
+}
+int ctz128(u128 x)
+{
+    ull lo = x;
+    return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll((ull)(x >> 64));
+}
+u128 gcd128(u128 a, u128 b)
+{
+    if(a==0 || b==0)
+    {
+        return a | b;
+    }
+    int shift = ctz128(a | b);
+    a >>= ctz128(a);
+    do
+    {
+        if((a >> 64) == 0 && (b >> 64) == 0)
+        {
+            // both fit in 64 bits now, finish there (a is odd, so no shift is lost)
+            return (u128)gcd64(a, b) << shift;
+        }
+        b >>= ctz128(b);
+        u128 lo = min(a, b), hi = max(a, b);
+        a = lo;
+        b = hi - lo;
+    } while(b);
+    return a << shift;
+}
+int gcd(int a, int b)
+{
+    return gcd64(abs((long long)a), abs((long long)b));
 }
 int gcd_mult(int arr[],int n)
 {
@@ -22,17 +66,158 @@ int gcd_mult(int arr[],int n)
     }
     return result;
 }
-int main() 
+// gcd of a[0..n) on all cores. Each thread folds its own slice, then the
+// slice results are combined pairwise. Once the running gcd is small most
+// elements are multiples of it, which is tested with a multiply by the
+// inverse of its odd part instead of a full gcd, so the fold runs at close
+// to memory speed. As soon as any thread reaches 1 the answer is known and
+// the others stop at their next check.
+ull gcd_range(const ull *a, size_t n)
+{
+    if(n == 0)
+    {
+        return 0;
+    }
+    int threads = max<size_t>(1, min<size_t>(thread::hardware_concurrency(), n / (1 << 16)));
+    vector<ull> part(threads, 0);
+    atomic<bool> foundOne(false);
+    auto worker = [&](int t)
+    {
+        size_t lo = n * t / threads, hi = n * (t + 1) / threads;
+        ull g = 0, mask = 0, inv = 0, lim = 0; // x is a multiple of g iff (x & mask) == 0 && x * inv <= lim
+        auto setDivisor = [&]()
+        {
+            int k = __builtin_ctzll(g);
+            ull odd = g >> k;
+            mask = (1ULL << k) - 1;
+            inv = odd;
+            for(int i=0; i<5; i++)
+                inv *= 2 - odd * inv;
+            lim = ~0ULL / odd;
+        };
+        const size_t CHECK = 4096;
+        for(size_t s = lo; s < hi && !foundOne.load(memory_order_relaxed); s += CHECK)
+        {
+            for(size_t i = s; i < min(hi, s + CHECK); i++)
+            {
+                ull x = a[i];
+                if(g != 0 && (x & mask) == 0 && x * inv <= lim)
+                {
+                    continue;
+                }
+                g = gcd64(g, x);
+                if(g != 0)
+                {
+                    setDivisor();
+                }
+            }
+            if(g == 1)
+            {
+                foundOne = true;
+            }
+        }
+        part[t] = g;
+    };
+    vector<thread> pool;
+    for(int t=1; t<threads; t++)
+    {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for(auto &th : pool)
+    {
+        th.join();
+    }
+    if(foundOne)
+    {
+        return 1;
+    }
+    for(int step=1; step<threads; step *= 2)
+    {
+        for(int t=0; t + step < threads; t += 2 * step)
+        {
+            part[t] = gcd64(part[t], part[t + step]);
+        }
+    }
+    return part[0];
+}
+// lcm(a, b) into res, false if it does not fit in 64 bits
+bool lcm64(ull a, ull b, ull &res)
+{
+    if(a==0 || b==0)
+    {
+        res = 0;
+        return true;
+    }
+    return !__builtin_mul_overflow(a / gcd64(a, b), b, &res);
+}
+// lcm of a[0..n) on all cores, false on 64-bit overflow. An overflow in
+// any slice stops every thread, since the total can only grow from there
+// (unless some element is 0, which makes the lcm 0).
+bool lcm_range(const ull *a, size_t n, ull &result)
+{
+    int threads = max<size_t>(1, min<size_t>(thread::hardware_concurrency(), n / (1 << 16)));
+    vector<ull> part(threads, 1);
+    atomic<bool> overflow(false);
+    auto worker = [&](int t)
+    {
+        size_t lo = n * t / threads, hi = n * (t + 1) / threads;
+        ull l = 1;
+        const size_t CHECK = 4096;
+        for(size_t s = lo; s < hi && !overflow.load(memory_order_relaxed); s += CHECK)
+        {
+            for(size_t i = s; i < min(hi, s + CHECK); i++)
+            {
+                if(!lcm64(l, a[i], l))
+                {
+                    overflow = true;
+                    break;
+                }
+            }
+        }
+        part[t] = l;
+    };
+    vector<thread> pool;
+    for(int t=1; t<threads; t++)
+    {
+        pool.emplace_back(worker, t);
+    }
+    worker(0);
+    for(auto &th : pool)
+    {
+        th.join();
+    }
+    for(int step=1; step<threads && !overflow; step *= 2)
+    {
+        for(int t=0; t + step < threads; t += 2 * step)
+        {
+            if(!lcm64(part[t], part[t + step], part[t]))
+            {
+                overflow = true;
+            }
+        }
+    }
+    if(overflow)
+    {
+        result = 0;
+        return find(a, a + n, 0ULL) != a + n;
+    }
+    result = part[0];
+    return true;
+}
+int main()
 {
- 
+
     int n;
     cin>>n;
-    int arr[n];
+    vector<ull> arr(n);
     for(int i=0;i<n;i++)
     {
-        cin>>arr[i];
+        long long x;
+        cin>>x;
+        arr[i] = abs(x);
     }
-    int final_gcd = gcd_mult(arr,n);
+    ull final_gcd = gcd_range(arr.data(),n);
     cout<<final_gcd<<endl;
     return 0;
 }
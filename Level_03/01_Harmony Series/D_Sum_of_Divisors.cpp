@@ -142,22 +142,118 @@ void faltu(T arg, const hello &...rest)
     faltu(rest...);
 }
 
-const int N = 10;
-int sumOfDivisors[N];
-
-int main()
+// One linear-sieve pass for any set of multiplicative functions. Every n is
+// reached exactly once as i * p with p its smallest prime factor, and
+// rest[n] = n with the power of that prime removed, so d, sigma and the
+// largest exponent come from rest[n] by one multiplication. Each function
+// gets its own array, only the requested ones are allocated.
+enum
 {
-    Siam84();
-    for (int i = 1; i <= N; i++)
+    F_DIV = 1,   // d(n), number of divisors
+    F_SIGMA = 2, // sigma(n), sum of divisors
+    F_PHI = 4,   // phi(n)
+    F_MU = 8,    // mobius mu(n)
+    F_EXP = 16   // largest exponent in the factorization of n
+};
+struct MultiplicativeTables
+{
+    vector<int> primes;
+    vector<int> divCount;
+    vector<ll> divSum;
+    vector<int> phi;
+    vector<int8_t> mu;
+    vector<uint8_t> maxExp;
+
+    void build(int n, int which)
     {
-        for (int j = i; j <= N; j += i)
+        bool needRest = which & (F_DIV | F_SIGMA | F_EXP);
+        vector<int> rest;
+        vector<uint8_t> e;   // e[n] = exponent of the smallest prime of n
+        vector<ll> powSum;   // powSum[n] = 1 + p + ... + p^e for that prime
+        vector<char> composite(n + 1, false);
+        primes.clear();
+        if (needRest)
         {
-            sumOfDivisors[j] += i;
+            rest.assign(n + 1, 1);
+            e.assign(n + 1, 0);
+        }
+        if (which & F_SIGMA)
+            powSum.assign(n + 1, 1);
+        if (which & F_DIV)
+            divCount.assign(n + 1, 1);
+        if (which & F_SIGMA)
+            divSum.assign(n + 1, 1);
+        if (which & F_PHI)
+            phi.assign(n + 1, 1);
+        if (which & F_MU)
+            mu.assign(n + 1, 1);
+        if (which & F_EXP)
+            maxExp.assign(n + 1, 0);
+        if (which & F_PHI)
+            phi[0] = 0;
+        for (int i = 2; i <= n; i++)
+        {
+            if (!composite[i])
+            {
+                primes.push_back(i);
+                if (needRest)
+                    e[i] = 1;
+                if (which & F_SIGMA)
+                {
+                    powSum[i] = i + 1;
+                    divSum[i] = i + 1;
+                }
+                if (which & F_DIV)
+                    divCount[i] = 2;
+                if (which & F_PHI)
+                    phi[i] = i - 1;
+                if (which & F_MU)
+                    mu[i] = -1;
+                if (which & F_EXP)
+                    maxExp[i] = 1;
+            }
+            for (int p : primes)
+            {
+                if (1LL * i * p > n)
+                    break;
+                int m = i * p;
+                composite[m] = true;
+                bool same = (i % p == 0); // p is also the smallest prime of i
+                if (needRest)
+                {
+                    rest[m] = same ? rest[i] : i;
+                    e[m] = same ? e[i] + 1 : 1;
+                }
+                if (which & F_DIV)
+                    divCount[m] = divCount[rest[m]] * (e[m] + 1);
+                if (which & F_SIGMA)
+                {
+                    powSum[m] = same ? powSum[i] * p + 1 : p + 1;
+                    divSum[m] = divSum[rest[m]] * powSum[m];
+                }
+                if (which & F_PHI)
+                    phi[m] = phi[i] * (same ? p : p - 1);
+                if (which & F_MU)
+                    mu[m] = same ? 0 : -mu[i];
+                if (which & F_EXP)
+                    maxExp[m] = max(maxExp[rest[m]], e[m]);
+                if (same)
+                    break;
+            }
         }
     }
+};
+
+const int N = 10;
+MultiplicativeTables mt;
+
+int main()
+{
+    Siam84();
+    mt.build(N, F_SIGMA);
     for (int i = 1; i <= N; i++)
     {
-        cout << i << ' ' << sumOfDivisors[i] << nline;
+        cout << i << ' ' << mt.divSum[i] << nline;
     }
     return 0;
 }
\ No newline at end of file
@@ -142,30 +142,94 @@ void faltu(T arg, const hello &...rest)
     faltu(rest...);
 }
 
-const int N = 100;
-vector<int> v[N];
-void Divisors(int n)
+// All divisor lists of 1..n in one contiguous CSR layout: the divisors of j
+// are values[offsets[j]] .. values[offsets[j + 1] - 1], in increasing order.
+// Built in two harmonic passes (count, then fill). Each thread owns a range
+// of j, so it writes only its own part of values and needs no locking.
+struct DivisorLists
 {
-    for (int i = 1; i <= n; i++)
+    vector<size_t> offsets;
+    vector<int> values;
+
+    // visit(i, j) for every divisor i of every j in [lo, hi], touching only
+    // multiples that fall inside the range. A divisor i <= len = hi - lo + 1
+    // walks its multiples from the first one in range. A bigger i has at most
+    // one multiple j = q * i there, so those are enumerated by the cofactor q
+    // instead, for q from hi / (len + 1) down to 1. The i-intervals of
+    // successive q do not overlap and grow as q shrinks, so every j still
+    // sees its divisors in increasing order. Cost is about len * ln(hi)
+    // with no per-i division past len.
+    template <typename V>
+    static void forDivisors(int lo, int hi, V visit)
     {
-        for (int j = i; j <= n; j += i)
+        int len = hi - lo + 1;
+        for (int i = 1; i <= len; i++)
         {
-            v[j].push_back(i);
+            for (int j = (lo + i - 1) / i * i; j <= hi; j += i)
+            {
+                visit(i, j);
+            }
+        }
+        for (int q = hi / (len + 1); q >= 1; q--)
+        {
+            int from = max(len + 1, (lo + q - 1) / q), to = hi / q;
+            for (int i = from, j = q * from; i <= to; i++, j += q)
+            {
+                visit(i, j);
+            }
         }
     }
-}
+    void build(int n, int threads = max(1u, thread::hardware_concurrency()))
+    {
+        vector<int> cnt(n + 1, 0);
+        // equal-length ranges of j: with forDivisors each costs about
+        // len * ln(hi), so they differ only by the slowly growing log
+        auto forRanges = [&](auto work)
+        {
+            vector<thread> pool;
+            for (int t = 0; t < threads; t++)
+            {
+                int lo = 1 + 1LL * n * t / threads, hi = 1LL * n * (t + 1) / threads;
+                if (lo > hi)
+                    continue;
+                pool.emplace_back(work, lo, hi);
+            }
+            for (auto &th : pool)
+            {
+                th.join();
+            }
+        };
+        forRanges([&](int lo, int hi)
+                  { forDivisors(lo, hi, [&](int, int j)
+                                { cnt[j]++; }); });
+        offsets.assign(n + 2, 0);
+        for (int j = 1; j <= n; j++)
+        {
+            offsets[j + 1] = offsets[j] + cnt[j];
+        }
+        values.resize(offsets[n + 1]);
+        forRanges([&](int lo, int hi)
+                  {
+            vector<size_t> pos(offsets.begin() + lo, offsets.begin() + hi + 1);
+            forDivisors(lo, hi, [&](int i, int j)
+                        { values[pos[j - lo]++] = i; }); });
+    }
+    const int *begin(int j) const { return values.data() + offsets[j]; }
+    const int *end(int j) const { return values.data() + offsets[j + 1]; }
+};
+DivisorLists v;
 int main()
 {
     Siam84();
     ll n;
     cin >> n;
-    Divisors(n);
+    v.build(n);
     for(int i = 1; i <= n; i++)
     {
             cout<< i << " : ";
-            for(auto it:v[i])
+            for (auto it = v.begin(i); it != v.end(i); it++)
             {
-                cout<< it << ' ';
+                cout<< *it << ' ';
             }
             cout<< nline;
     }
@@ -0,0 +1,112 @@
+#include <bits/stdc++.h>
+using namespace std;
+#define ll long long int
+#define nline char(10)
+#define Fast                          \
+    ios_base::sync_with_stdio(false); \
+    cin.tie(0);                       \
+    cout.tie(0);
+#define Yes cout << "YES\n"
+#define No cout << "NO\n"
+#define print(v)           \
+    for (auto &it : v)     \
+    {                      \
+        cout << it << ' '; \
+    }                      \
+    cout << endl;
+
+// Benchmark for the parallel segmented sieve: worker threads pull segments
+// from a shared counter. PrimeFactor's WheelSieve::build runs the same
+// scheme on its mod-30 bitmap; here primes are only counted per segment,
+// so bounds like 1e10 fit in memory.
+const int SEGMENT = 1 << 15; // odd numbers per segment
+ll countPrimes(ll N, int threads)
+{
+    if (N < 2)
+        return 0;
+    ll root = sqrtl(N);
+    while (root * root > N)
+        root--;
+    while ((root + 1) * (root + 1) <= N)
+        root++;
+    vector<int> base;
+    vector<char> small(root + 1, true);
+    for (ll i = 3; i <= root; i += 2)
+    {
+        if (small[i])
+        {
+            base.push_back(i);
+            for (ll j = i * i; j <= root; j += 2 * i)
+            {
+                small[j] = false;
+            }
+        }
+    }
+    ll segments = (N - 1) / 2 / SEGMENT + 1;
+    vector<ll> found(segments);
+    atomic<ll> nextSegment(0);
+    auto worker = [&]()
+    {
+        vector<char> block(SEGMENT);
+        for (ll s; (s = nextSegment++) < segments;)
+        {
+            ll low = 2 * s * SEGMENT + 1;
+            ll high = min(low + 2LL * (SEGMENT - 1), N);
+            int len = (high - low) / 2 + 1;
+            fill(block.begin(), block.begin() + len, true);
+            if (s == 0)
+                block[0] = false;
+            for (ll p : base)
+            {
+                if (p * p > high)
+                    break;
+                ll start = max(p * p, (low + p - 1) / p * p);
+                if (start % 2 == 0)
+                    start += p;
+                for (ll j = start; j <= high; j += 2 * p)
+                {
+                    block[(j - low) >> 1] = false;
+                }
+            }
+            found[s] = count(block.begin(), block.begin() + len, true);
+        }
+    };
+    vector<thread> pool;
+    for (ll t = 1; t < min((ll)threads, segments); t++)
+    {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto &th : pool)
+    {
+        th.join();
+    }
+    return 1 + accumulate(found.begin(), found.end(), 0LL);
+}
+int main()
+{
+    Fast;
+    int hw = max(1u, thread::hardware_concurrency());
+    vector<int> threadCounts;
+    for (int t = 1; t < hw; t *= 2)
+    {
+        threadCounts.push_back(t);
+    }
+    threadCounts.push_back(hw);
+    for (ll N : {(ll)1e9, (ll)1e10})
+    {
+        double single = 0;
+        for (int t : threadCounts)
+        {
+            auto start = chrono::steady_clock::now();
+            ll cnt = countPrimes(N, t);
+            double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (t == 1)
+                single = sec;
+            cout << "N = " << N << "  threads = " << t << "  pi(N) = " << cnt
+                 << "  time = " << fixed << setprecision(3) << sec << "s"
+                 << "  speedup = " << setprecision(2) << single / sec << "x" << nline;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,187 @@
+#include <bits/stdc++.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+using namespace std;
+#define ll long long int
+#define nline char(10)
+#define Fast                          \
+    ios_base::sync_with_stdio(false); \
+    cin.tie(0);                       \
+    cout.tie(0);
+#define Yes cout << "YES\n"
+#define No cout << "NO\n"
+#define print(v)           \
+    for (auto &it : v)     \
+    {                      \
+        cout << it << ' '; \
+    }                      \
+    cout << endl;
+
+// One segment covers 2 * SEGMENT numbers (odd numbers only), small enough to stay in L1/L2
+const int SEGMENT = 1 << 15;
+vector<int> basePrimes;
+void seive(int limit)
+{
+    // Plain sieve for the base primes up to sqrt(R)
+    basePrimes.clear();
+    vector<char> isPrime(limit + 1, true);
+    for (int i = 2; 1LL * i * i <= limit; i++)
+    {
+        if (isPrime[i])
+        {
+            for (int j = i * i; j <= limit; j += i)
+            {
+                isPrime[j] = false;
+            }
+        }
+    }
+    for (int i = 2; i <= limit; i++)
+    {
+        if (isPrime[i])
+            basePrimes.push_back(i);
+    }
+}
+ll isqrt(ll n)
+{
+    ll r = sqrtl(n);
+    while (r * r > n)
+        r--;
+    while ((r + 1) * (r + 1) <= n)
+        r++;
+    return r;
+}
+// Pre-sieving: instead of crossing off 3, 5, ..., 23 one by one in every
+// segment, copy their precomputed pattern. Index k stands for the odd number
+// 2k + 1, so the pattern of a set of primes repeats every (product) entries.
+const int PRE1 = 3 * 5 * 7 * 11 * 13, PRE2 = 17 * 19 * 23;
+const int PRESIEVED = 8; // basePrimes[1..8] = 3 .. 23 never reach the crossing-off loop
+vector<char> pattern1, pattern2;
+void buildPatterns()
+{
+    auto make = [](vector<char> &pat, int period, initializer_list<int> ps)
+    {
+        pat.assign(period + SEGMENT, true);
+        for (int k = 0; k < (int)pat.size(); k++)
+        {
+            for (int p : ps)
+            {
+                if ((2 * k + 1) % p == 0)
+                    pat[k] = false;
+            }
+        }
+    };
+    make(pattern1, PRE1, {3, 5, 7, 11, 13});
+    make(pattern2, PRE2, {17, 19, 23});
+}
+// block[i] &= src[i], 32 or 16 bytes at a time with AVX2 / SSE2
+void andBytes(char *block, const char *src, int len)
+{
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(block + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(block + i), _mm256_and_si256(a, b));
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)(block + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(block + i), _mm_and_si128(a, b));
+    }
+#endif
+    for (; i < len; i++)
+    {
+        block[i] &= src[i];
+    }
+}
+// block[i] stands for low + 2 * i, low odd
+void presieve(char *block, ll low, int len)
+{
+    ll k0 = (low - 1) / 2;
+    memcpy(block, pattern1.data() + k0 % PRE1, len);
+    andBytes(block, pattern2.data() + k0 % PRE2, len);
+    // the patterns crossed off the small primes themselves too
+    for (int p : {3, 5, 7, 11, 13, 17, 19, 23})
+    {
+        if (p >= low && p < low + 2LL * len)
+            block[(p - low) >> 1] = true;
+    }
+}
+// Pre-sieve benchmark: counts the primes up to N with the segmented sieve of
+// Printing_some_primes.cpp, once crossing off 3 .. 23 in the scalar loop like
+// before and once stamping them with presieve().
+ll countPrimes(ll N, bool usePresieve)
+{
+    if (N < 2)
+        return 0;
+    seive(isqrt(N));
+    if (pattern1.empty())
+        buildPatterns();
+    vector<ll> next(basePrimes.size());
+    for (size_t k = 1; k < basePrimes.size(); k++)
+    {
+        next[k] = 1LL * basePrimes[k] * basePrimes[k];
+    }
+    ll cnt = 1; // 2
+    vector<char> block(SEGMENT);
+    for (ll low = 3; low <= N; low += 2LL * SEGMENT)
+    {
+        ll high = min(low + 2LL * SEGMENT - 1, N);
+        int len = (high - low) / 2 + 1;
+        size_t first = 1;
+        if (usePresieve)
+        {
+            presieve(block.data(), low, len);
+            first += PRESIEVED;
+        }
+        else
+        {
+            fill(block.begin(), block.begin() + len, true);
+        }
+        for (size_t k = first; k < basePrimes.size(); k++)
+        {
+            ll p = basePrimes[k];
+            if (p * p > high)
+                break;
+            ll j = next[k];
+            for (; j <= high; j += 2 * p)
+            {
+                block[(j - low) >> 1] = false;
+            }
+            next[k] = j;
+        }
+        cnt += count(block.begin(), block.begin() + len, true);
+    }
+    return cnt;
+}
+int main()
+{
+    Fast;
+#if defined(__AVX2__)
+    cout << "presieve AND kernel: AVX2" << nline;
+#elif defined(__SSE2__)
+    cout << "presieve AND kernel: SSE2" << nline;
+#else
+    cout << "presieve AND kernel: scalar" << nline;
+#endif
+    for (ll N : {(ll)1e8, (ll)1e9})
+    {
+        double base = 0;
+        for (bool usePresieve : {false, true})
+        {
+            auto start = chrono::steady_clock::now();
+            ll cnt = countPrimes(N, usePresieve);
+            double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (!usePresieve)
+                base = sec;
+            cout << "N = " << N << (usePresieve ? "  presieve  " : "  scalar    ") << "pi(N) = " << cnt
+                 << "  time = " << fixed << setprecision(3) << sec << "s"
+                 << "  speedup = " << setprecision(2) << base / sec << "x" << nline;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <bits/stdc++.h>
+using namespace std;
+#define ll long long int
+#define nline char(10)
+#define Fast                          \
+    ios_base::sync_with_stdio(false); \
+    cin.tie(0);                       \
+    cout.tie(0);
+#define Yes cout << "YES\n"
+#define No cout << "NO\n"
+#define print(v)           \
+    for (auto &it : v)     \
+    {                      \
+        cout << it << ' '; \
+    }                      \
+    cout << endl;
+
+// pi(x) by the Meissel-Lehmer method: only numbers up to about x^(2/3) are
+// sieved, everything above comes from the recursive phi / P2 formulas.
+vector<int> primes;
+vector<int> piTable; // piTable[i] = number of primes <= i, for i below the sieve bound
+void seive(int N)
+{
+    primes.clear();
+    vector<char> isPrime(N + 1, true);
+    isPrime[0] = isPrime[1] = false;
+    for (int i = 2; 1LL * i * i <= N; i++)
+    {
+        if (isPrime[i])
+        {
+            for (int j = i * i; j <= N; j += i)
+            {
+                isPrime[j] = false;
+            }
+        }
+    }
+    piTable.assign(N + 1, 0);
+    for (int i = 2; i <= N; i++)
+    {
+        piTable[i] = piTable[i - 1];
+        if (isPrime[i])
+        {
+            primes.push_back(i);
+            piTable[i]++;
+        }
+    }
+}
+// phi(x, a) = how many numbers in [1, x] have no prime factor among the first a primes.
+// For a <= SMALL_A it is periodic with the primorial, so it comes from a table.
+const int SMALL_A = 6;
+const int PRIMORIAL = 2 * 3 * 5 * 7 * 11 * 13;
+vector<int> phiTable[SMALL_A + 1]; // phiTable[a][r] = phi(r, a), 0 <= r <= PRIMORIAL
+void buildPhiTable()
+{
+    phiTable[0].resize(PRIMORIAL + 1);
+    iota(phiTable[0].begin(), phiTable[0].end(), 0);
+    for (int a = 1; a <= SMALL_A; a++)
+    {
+        phiTable[a].resize(PRIMORIAL + 1);
+        for (int r = 0; r <= PRIMORIAL; r++)
+        {
+            phiTable[a][r] = phiTable[a - 1][r] - phiTable[a - 1][r / primes[a - 1]];
+        }
+    }
+}
+ll iroot(ll x, int k) // floor(x^(1/k))
+{
+    ll r = pow((long double)x, 1.0L / k);
+    while (r > 0 && (__int128)pow((long double)r, k) > x)
+        r--;
+    while ((__int128)pow((long double)(r + 1), k) <= x)
+        r++;
+    return r;
+}
+ll prime_count(ll x);
+ll phi(ll x, int a)
+{
+    if (a == 0)
+        return x;
+    if (a <= SMALL_A)
+        return x / PRIMORIAL * phiTable[a][PRIMORIAL] + phiTable[a][x % PRIMORIAL];
+    if (x < (ll)piTable.size() && 1LL * primes[a - 1] * primes[a - 1] >= x)
+        return max(0LL, (ll)piTable[x] - a + 1);
+    // phi(x, a) = phi(x, SMALL_A) - sum of phi(x / p_i, i - 1) for SMALL_A < i <= a
+    ll res = phi(x, SMALL_A);
+    for (int i = SMALL_A + 1; i <= a; i++)
+    {
+        ll y = x / primes[i - 1];
+        if (y < primes[i - 1])
+        {
+            // only 1 survives in [1, y] from here on
+            res -= (y >= 1);
+            continue;
+        }
+        res -= phi(y, i - 1);
+    }
+    return res;
+}
+ll prime_count(ll x)
+{
+    if (x < (ll)piTable.size())
+        return piTable[x];
+    ll a = prime_count(iroot(x, 4));
+    ll b = prime_count(iroot(x, 2));
+    ll c = prime_count(iroot(x, 3));
+    ll sum = phi(x, a) + (b + a - 2) * (b - a + 1) / 2;
+    for (ll i = a + 1; i <= b; i++)
+    {
+        ll w = x / primes[i - 1];
+        sum -= prime_count(w);
+        if (i <= c)
+        {
+            ll bi = prime_count(iroot(w, 2));
+            for (ll j = i; j <= bi; j++)
+            {
+                sum -= prime_count(w / primes[j - 1]) - (j - 1);
+            }
+        }
+    }
+    return sum;
+}
+// Lehmer's formula reads primes up to sqrt(x), so the sieve bound follows the
+// largest query. Past 1e16 that sieve (and piTable) would no longer fit in memory.
+const ll MAX_X = 1e16;
+int main()
+{
+    Fast;
+    int t;
+    cin >> t;
+    vector<ll> queries(t);
+    ll minX = 0, maxX = 0;
+    for (ll &x : queries)
+    {
+        cin >> x;
+        minX = min(minX, x);
+        maxX = max(maxX, x);
+    }
+    if (minX < 0 || maxX > MAX_X)
+    {
+        cout << "x must be between 0 and " << MAX_X << nline;
+        return 1;
+    }
+    int limit = max<ll>(1e7, iroot(maxX, 2) + 1);
+    seive(limit);
+    buildPhiTable();
+    for (ll x : queries)
+    {
+        cout << prime_count(x) << nline;
+    }
+    return 0;
+}
\ No newline at end of file
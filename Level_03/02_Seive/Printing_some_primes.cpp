@@ -1,5 +1,8 @@
 // Will work CF Compiler Machine
 #include <bits/stdc++.h>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 using namespace std;
 #define ll long long int
 #define nline char(10)
@@ -16,43 +19,174 @@ using namespace std;
     }                      \
     cout << endl;
 
-const int N = 1e8;
-bitset<N> isPrime;
-vector<int> primes;
-void seive()
+const ll N = 1e8;
+// One segment covers 2 * SEGMENT numbers (odd numbers only), small enough to stay in L1/L2
+const int SEGMENT = 1 << 15;
+vector<int> basePrimes;
+void seive(int limit)
 {
-    for (int i = 3; i <= N; i += 2)
+    // Plain sieve for the base primes up to sqrt(R)
+    basePrimes.clear();
+    vector<char> isPrime(limit + 1, true);
+    for (int i = 2; 1LL * i * i <= limit; i++)
     {
-        isPrime[i] = true;
-    }
-    for (int i = 3; i <= sqrt(N); i += 2)
-    {
-        if (isPrime[i] == true)
+        if (isPrime[i])
         {
-            for (int j = i * 2; j <= N; j += i)
+            for (int j = i * i; j <= limit; j += i)
             {
                 isPrime[j] = false;
             }
         }
     }
-    primes.push_back(2);
-    for (int i = 3; i <= N; i+=2)
+    for (int i = 2; i <= limit; i++)
     {
         if (isPrime[i])
-            primes.push_back(i);
+            basePrimes.push_back(i);
     }
 }
-void Display()
+ll isqrt(ll n)
+{
+    ll r = sqrtl(n);
+    while (r * r > n)
+        r--;
+    while ((r + 1) * (r + 1) <= n)
+        r++;
+    return r;
+}
+// Pre-sieving: instead of crossing off 3, 5, ..., 23 one by one in every
+// segment, copy their precomputed pattern. Index k stands for the odd number
+// 2k + 1, so the pattern of a set of primes repeats every (product) entries.
+const int PRE1 = 3 * 5 * 7 * 11 * 13, PRE2 = 17 * 19 * 23;
+const int PRESIEVED = 8; // basePrimes[1..8] = 3 .. 23 never reach the crossing-off loop
+vector<char> pattern1, pattern2;
+void buildPatterns()
+{
+    auto make = [](vector<char> &pat, int period, initializer_list<int> ps)
+    {
+        pat.assign(period + SEGMENT, true);
+        for (int k = 0; k < (int)pat.size(); k++)
+        {
+            for (int p : ps)
+            {
+                if ((2 * k + 1) % p == 0)
+                    pat[k] = false;
+            }
+        }
+    };
+    make(pattern1, PRE1, {3, 5, 7, 11, 13});
+    make(pattern2, PRE2, {17, 19, 23});
+}
+// block[i] &= src[i], 32 or 16 bytes at a time with AVX2 / SSE2
+void andBytes(char *block, const char *src, int len)
+{
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= len; i += 32)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(block + i));
+        __m256i b = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(block + i), _mm256_and_si256(a, b));
+    }
+#elif defined(__SSE2__)
+    for (; i + 16 <= len; i += 16)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)(block + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(block + i), _mm_and_si128(a, b));
+    }
+#endif
+    for (; i < len; i++)
+    {
+        block[i] &= src[i];
+    }
+}
+// block[i] stands for low + 2 * i, low odd
+void presieve(char *block, ll low, int len)
 {
-    for (int i = 0; i <= primes.size(); i += 100)
+    ll k0 = (low - 1) / 2;
+    memcpy(block, pattern1.data() + k0 % PRE1, len);
+    andBytes(block, pattern2.data() + k0 % PRE2, len);
+    // the patterns crossed off the small primes themselves too
+    for (int p : {3, 5, 7, 11, 13, 17, 19, 23})
     {
-        cout << primes[i] << nline;
+        if (p >= low && p < low + 2LL * len)
+            block[(p - low) >> 1] = true;
     }
 }
+// Sieve the window [L, R] (R up to ~1e12) segment by segment and call
+// found(p) for every prime in increasing order, so nothing bigger than
+// one segment has to be kept in memory.
+template <typename F>
+void segmentedSeive(ll L, ll R, F found)
+{
+    if (R < 2 || L > R)
+        return;
+    L = max(L, 2LL);
+    seive(isqrt(R));
+    if (L == 2)
+    {
+        found(2);
+        L = 3;
+    }
+    if (L % 2 == 0)
+        L++;
+    // next[k] : next odd multiple of basePrimes[k] to cross off, carried from segment to segment
+    vector<ll> next(basePrimes.size());
+    for (size_t k = 1; k < basePrimes.size(); k++)
+    {
+        ll p = basePrimes[k];
+        ll start = max(p * p, (L + p - 1) / p * p);
+        if (start % 2 == 0)
+            start += p;
+        next[k] = start;
+    }
+    if (pattern1.empty())
+        buildPatterns();
+    vector<char> block(SEGMENT);
+    for (ll low = L; low <= R; low += 2LL * SEGMENT)
+    {
+        ll high = min(low + 2LL * SEGMENT - 1, R);
+        int len = (high - low) / 2 + 1; // block[i] stands for low + 2 * i
+        presieve(block.data(), low, len);
+        for (size_t k = 1 + PRESIEVED; k < basePrimes.size(); k++)
+        {
+            ll p = basePrimes[k];
+            if (p * p > high)
+                break;
+            ll j = next[k];
+            for (; j <= high; j += 2 * p)
+            {
+                block[(j - low) >> 1] = false;
+            }
+            next[k] = j;
+        }
+        for (int i = 0; i < len; i++)
+        {
+            if (block[i])
+                found(low + 2LL * i);
+        }
+    }
+}
+vector<ll> primesInRange(ll L, ll R)
+{
+    vector<ll> res;
+    segmentedSeive(L, R, [&](ll p)
+                   { res.push_back(p); });
+    return res;
+}
+void Display()
+{
+    // Print every 100th prime without storing the whole prime list
+    ll idx = 0;
+    segmentedSeive(1, N, [&](ll p)
+                   {
+        if (idx % 100 == 0)
+            cout << p << nline;
+        idx++; });
+}
 int main()
 {
     Fast;
-    seive();
     Display();
     return 0;
-}
\ No newline at end of file
+}
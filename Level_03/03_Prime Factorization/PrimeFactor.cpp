@@ -15,57 +15,291 @@ using namespace std;
     }                      \
     cout << endl;
 
-const int N = 1e7 + 123;
-bitset<N> isPrime;
-vector<int> primes;
-void seive(int N)
+// Mod 30 wheel: only the 8 residues coprime to 30 can be prime (besides 2, 3, 5),
+// so one byte covers 30 numbers and the table is ~N / 30 bytes instead of N / 8.
+class WheelSieve
 {
-    for (int i = 3; i <= N; i += 2)
+    static constexpr int wheel[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+    ll limit = 0;
+    vector<uint8_t> bits; // bit i of bits[k] <=> 30 * k + wheel[i] is prime
+
+    static int slot(int r) // position of residue r in the wheel, -1 if gcd(r, 30) > 1
     {
-        isPrime[i] = true;
+        static const array<int8_t, 30> pos = []
+        {
+            array<int8_t, 30> a;
+            a.fill(-1);
+            for (int i = 0; i < 8; i++)
+                a[wheel[i]] = i;
+            return a;
+        }();
+        return pos[r];
     }
-    for (int i = 3; i <= sqrt(N); i += 2)
+    static uint8_t upTo(int r) // bits whose residue is <= r
     {
-        if (isPrime[i] == true)
+        uint8_t m = 0;
+        for (int i = 0; i < 8; i++)
+        {
+            if (wheel[i] <= r)
+                m |= 1 << i;
+        }
+        return m;
+    }
+
+public:
+    // Parallel segmented sieve straight on the wheel bitmap. Worker threads
+    // pull SEGMENT-byte ranges from a shared counter, so the dense low
+    // segments and the sparse high ones balance out, and every thread writes
+    // only its own bytes. Each base prime p crosses off p * q for q on the
+    // wheel only, starting at the first such q with p * q in the segment.
+    static const int SEGMENT = 1 << 15; // bytes (30 numbers each) per segment
+    void build(ll N, int threads = max(1u, thread::hardware_concurrency()))
+    {
+        limit = N;
+        bits.assign(N / 30 + 1, 0xFF);
+        bits[0] &= ~1; // 1 is not prime
+        bits.back() &= upTo(N % 30);
+        ll root = sqrtl(N);
+        vector<int> base;
+        vector<char> small(root + 1, true);
+        for (ll i = 2; i <= root; i++)
+        {
+            if (!small[i])
+                continue;
+            if (i >= 7)
+                base.push_back(i);
+            for (ll j = i * i; j <= root; j += i)
+            {
+                small[j] = false;
+            }
+        }
+        ll segments = (ll)(bits.size() - 1) / SEGMENT + 1;
+        atomic<ll> nextSegment(0);
+        auto worker = [&]()
+        {
+            for (ll s; (s = nextSegment++) < segments;)
+            {
+                ll low = 30 * s * SEGMENT, high = min(low + 30LL * SEGMENT - 1, N);
+                for (ll p : base)
+                {
+                    if (p * p > high)
+                        break;
+                    ll q = max(p, (low + p - 1) / p);
+                    ll qk = q / 30, qi = 0;
+                    while (qi < 8 && wheel[qi] < q % 30)
+                        qi++;
+                    if (qi == 8)
+                        qi = 0, qk++;
+                    for (ll m; (m = p * (30 * qk + wheel[qi])) <= high;)
+                    {
+                        bits[m / 30] &= ~(1 << slot(m % 30));
+                        if (++qi == 8)
+                            qi = 0, qk++;
+                    }
+                }
+            }
+        };
+        vector<thread> pool;
+        for (ll t = 1; t < min<ll>(threads, segments); t++)
+        {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto &th : pool)
+        {
+            th.join();
+        }
+    }
+    bool isPrime(ll n) const
+    {
+        if (n < 7)
+            return n == 2 || n == 3 || n == 5;
+        int s = slot(n % 30);
+        return n <= limit && s >= 0 && (bits[n / 30] >> s & 1);
+    }
+    bool operator[](ll n) const
+    {
+        return isPrime(n);
+    }
+    // number of primes in [l, r]
+    ll count(ll l, ll r) const
+    {
+        r = min(r, limit);
+        ll res = 0;
+        for (int p : {2, 3, 5})
+        {
+            if (l <= p && p <= r)
+                res++;
+        }
+        l = max(l, 7LL);
+        if (l > r)
+            return res;
+        ll kl = l / 30, kr = r / 30;
+        uint8_t first = ~upTo(l % 30 - 1), last = upTo(r % 30);
+        if (kl == kr)
+            return res + __builtin_popcount(bits[kl] & first & last);
+        res += __builtin_popcount(bits[kl] & first) + __builtin_popcount(bits[kr] & last);
+        for (ll k = kl + 1; k < kr; k++)
+        {
+            res += __builtin_popcount(bits[k]);
+        }
+        return res;
+    }
+    // call f(p) for every prime p in [l, r] in increasing order
+    template <typename F>
+    void forEach(ll l, ll r, F f) const
+    {
+        r = min(r, limit);
+        for (int p : {2, 3, 5})
+        {
+            if (l <= p && p <= r)
+                f(p);
+        }
+        for (ll k = max(l, 7LL) / 30; k <= r / 30; k++)
         {
-            for (int j = i * 2; j <= N; j += i)
+            for (unsigned b = bits[k]; b; b &= b - 1)
             {
-                isPrime[j] = false;
+                ll p = 30 * k + wheel[__builtin_ctz(b)];
+                if (p >= l && p <= r && p >= 7)
+                    f(p);
             }
         }
     }
-    primes.push_back(2);
-    for (int i = 3; i <= N; i += 2)
+};
+WheelSieve isPrime;
+vector<int> primes;
+// primes up to N, read back off the wheel bitmap in increasing order
+void seive(int N, int threads = max(1u, thread::hardware_concurrency()))
+{
+    primes.clear();
+    if (N < 2)
+        return;
+    isPrime.build(N, threads);
+    primes.reserve(isPrime.count(2, N));
+    isPrime.forEach(2, N, [&](ll p)
+                    { primes.push_back(p); });
+}
+// Linear (Euler) sieve: every composite is crossed off exactly once, by its
+// smallest prime factor. spfIdx[n] = 0 means n is prime, otherwise
+// spfPrimes[spfIdx[n] - 1] is the smallest prime factor of n. That factor is
+// at most sqrt(n), so a 16-bit index is enough for bounds up to ~6e11.
+vector<uint16_t> spfIdx;
+vector<int> spfPrimes; // primes up to sqrt(bound)
+void linearSeive(int n)
+{
+    spfIdx.assign(n + 1, 0);
+    spfPrimes.clear();
+    for (int i = 2; i <= n; i++)
     {
-        if (isPrime[i])
-            primes.push_back(i);
+        int lp = spfIdx[i] ? spfPrimes[spfIdx[i] - 1] : i;
+        if (!spfIdx[i] && 1LL * i * i <= n)
+            spfPrimes.push_back(i);
+        for (int k = 0; k < (int)spfPrimes.size(); k++)
+        {
+            int p = spfPrimes[k];
+            if (p > lp || 1LL * i * p > n)
+                break;
+            spfIdx[i * p] = k + 1;
+        }
     }
 }
-vector<int> PrimeFactor(int n)
+// (prime, exponent) pairs of n in increasing order. O(number of prime factors)
+// inside the table, trial division by primes until n drops into it otherwise.
+vector<pair<ll, int>> factorize(ll n)
 {
-    vector<int> primeNum;
+    vector<pair<ll, int>> res;
+    ll bound = spfIdx.size();
     for (auto it : primes)
     {
-        if (1LL * it * it > n)
+        if (n < bound || 1LL * it * it > n)
             break;
         if (n % it == 0)
         {
-            primeNum.push_back(it);
+            int cnt = 0;
             while (n % it == 0)
             {
+                cnt++;
                 n /= it;
             }
+            res.push_back({it, cnt});
         }
     }
+    while (n > 1 && n < bound)
+    {
+        ll p = spfIdx[n] ? spfPrimes[spfIdx[n] - 1] : n;
+        int cnt = 0;
+        while (n % p == 0)
+        {
+            cnt++;
+            n /= p;
+        }
+        res.push_back({p, cnt});
+    }
+    if (n > 1)
+        res.push_back({n, 1});
+    return res;
+}
+// Sieve run by the compiler: smallest prime factors up to LIMIT are baked
+// into the binary, so inputs up to LIMIT need no runtime seive().
+// spf[n] = 0 means n is prime. Bounds past ~2.6e5 need -fconstexpr-loop-limit.
+template <int LIMIT>
+struct StaticSeive
+{
+    uint16_t spf[LIMIT + 1] = {};
+    constexpr StaticSeive()
+    {
+        for (int i = 2; i * i <= LIMIT; i++)
+        {
+            if (spf[i] == 0)
+            {
+                for (int j = i * i; j <= LIMIT; j += i)
+                {
+                    if (spf[j] == 0)
+                        spf[j] = i;
+                }
+            }
+        }
+    }
+};
+const int SMALL_LIMIT = 1 << 16;
+constexpr StaticSeive<SMALL_LIMIT> smallSeive;
+// (prime, exponent) pairs of 1 <= n <= SMALL_LIMIT straight from the compile-time table
+vector<pair<ll, int>> staticFactorize(int n)
+{
+    vector<pair<ll, int>> res;
+    while (n > 1)
+    {
+        int p = smallSeive.spf[n] ? smallSeive.spf[n] : n;
+        int cnt = 0;
+        while (n % p == 0)
+        {
+            cnt++;
+            n /= p;
+        }
+        res.push_back({p, cnt});
+    }
+    return res;
+}
+vector<int> PrimeFactor(int n)
+{
+    vector<int> primeNum;
+    for (auto it : n <= SMALL_LIMIT ? staticFactorize(n) : factorize(n))
+    {
+        primeNum.push_back(it.first);
+    }
     return primeNum;
 }
 int main()
 {
     Fast;
-    int limit = 1e3;
-    seive(limit);
+    int limit = 1e5; // covers sqrt of any int, the table takes over below 1e7
     int n;
     cin >> n;
+    if (n > SMALL_LIMIT)
+    {
+        seive(limit);
+        linearSeive(1e7);
+    }
     vector<int> ans = PrimeFactor(n);
     for (auto u : ans)
     {
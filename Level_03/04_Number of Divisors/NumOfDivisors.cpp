@@ -1,4 +1,8 @@
 #include <bits/stdc++.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 using namespace std;
 #define ll long long int
 #define nline char(10)
@@ -15,93 +19,575 @@ using namespace std;
     }                      \
     cout << endl;
 
-const int N = 1e7 + 123;
-bitset<N> isPrime;
-vector<int> primes;
-void seive(int N)
+// Linear (Euler) sieve: every composite is crossed off exactly once, by its
+// smallest prime factor. spfIdx[n] = 0 means n is prime, otherwise
+// spfPrimes[spfIdx[n] - 1] is the smallest prime factor of n. That factor is
+// at most sqrt(n), so a 16-bit index is enough for bounds up to ~6e11.
+vector<uint16_t> spfIdx;
+vector<int> spfPrimes; // primes up to sqrt(bound)
+void linearSeive(int n)
 {
-    for (int i = 3; i <= N; i += 2)
+    spfIdx.assign(n + 1, 0);
+    spfPrimes.clear();
+    for (int i = 2; i <= n; i++)
     {
-        isPrime[i] = true;
+        int lp = spfIdx[i] ? spfPrimes[spfIdx[i] - 1] : i;
+        if (!spfIdx[i] && 1LL * i * i <= n)
+            spfPrimes.push_back(i);
+        for (int k = 0; k < (int)spfPrimes.size(); k++)
+        {
+            int p = spfPrimes[k];
+            if (p > lp || 1LL * i * p > n)
+                break;
+            spfIdx[i * p] = k + 1;
+        }
     }
-    for (int i = 3; i <= sqrt(N); i += 2)
+}
+// Sieve run by the compiler: smallest prime factors and the primes up to LIMIT
+// are baked into the binary, so inputs up to LIMIT need no runtime sieve.
+// spf[n] = 0 means n is prime. Bounds past ~2.6e5 need -fconstexpr-loop-limit.
+template <int LIMIT>
+struct StaticSeive
+{
+    uint16_t spf[LIMIT + 1] = {};
+    int primeCount = 0;
+    constexpr StaticSeive()
     {
-        if (isPrime[i] == true)
+        for (int i = 2; i * i <= LIMIT; i++)
         {
-            for (int j = i * 2; j <= N; j += i)
+            if (spf[i] == 0)
             {
-                isPrime[j] = false;
+                for (int j = i * i; j <= LIMIT; j += i)
+                {
+                    if (spf[j] == 0)
+                        spf[j] = i;
+                }
             }
         }
+        for (int i = 2; i <= LIMIT; i++)
+        {
+            primeCount += (spf[i] == 0);
+        }
+    }
+};
+template <int LIMIT, int COUNT>
+struct StaticPrimeList
+{
+    int p[COUNT] = {};
+    constexpr StaticPrimeList(const StaticSeive<LIMIT> &s)
+    {
+        for (int i = 2, k = 0; i <= LIMIT; i++)
+        {
+            if (s.spf[i] == 0)
+                p[k++] = i;
+        }
+    }
+};
+const int SMALL_LIMIT = 1 << 16;
+constexpr StaticSeive<SMALL_LIMIT> smallSeive;
+constexpr StaticPrimeList<SMALL_LIMIT, smallSeive.primeCount> smallPrimes(smallSeive);
+// 64-bit factorization: deterministic Miller-Rabin and Brent's Pollard rho.
+// Both work in Montgomery form, so the hot loops multiply without any
+// 128-bit division. Valid for odd moduli below 2^63.
+typedef unsigned long long ull;
+struct Montgomery
+{
+    ull n, nInv, r2; // nInv = n^-1 mod 2^64, r2 = 2^128 mod n
+    Montgomery(ull n) : n(n)
+    {
+        nInv = n;
+        for (int i = 0; i < 5; i++)
+            nInv *= 2 - n * nInv;
+        ull r = -n % n;
+        r2 = (unsigned __int128)r * r % n;
     }
-    primes.push_back(2);
-    for (int i = 3; i <= N; i += 2)
+    ull reduce(unsigned __int128 x) const // x / 2^64 mod n
     {
-        if (isPrime[i])
-            primes.push_back(i);
+        ull q = (ull)x * nInv;
+        ull m = ((unsigned __int128)q * n) >> 64;
+        ull hi = x >> 64;
+        return hi >= m ? hi - m : hi + n - m;
+    }
+    ull to(ull a) const { return reduce((unsigned __int128)(a % n) * r2); }
+    ull from(ull a) const { return reduce(a); }
+    ull mul(ull a, ull b) const { return reduce((unsigned __int128)a * b); }
+    ull pow(ull a, ull e) const
+    {
+        ull res = to(1);
+        while (e)
+        {
+            if (e & 1)
+                res = mul(res, a);
+            a = mul(a, a);
+            e >>= 1;
+        }
+        return res;
     }
+};
+bool millerRabin(ull n)
+{
+    if (n < 2)
+        return false;
+    for (ull p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+    {
+        if (n % p == 0)
+            return n == p;
+    }
+    Montgomery mg(n);
+    ull one = mg.to(1), minusOne = mg.to(n - 1);
+    ull d = n - 1;
+    int s = __builtin_ctzll(d);
+    d >>= s;
+    // this witness set is exact for every n < 2^64
+    for (ull a : {2, 325, 9375, 28178, 450775, 9780504, 1795265022})
+    {
+        if (a % n == 0)
+            continue;
+        ull x = mg.pow(mg.to(a), d);
+        if (x == one || x == minusOne)
+            continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; r++)
+        {
+            x = mg.mul(x, x);
+            composite = (x != minusOne);
+        }
+        if (composite)
+            return false;
+    }
+    return true;
 }
-// Way 1
-map<int, int> NumOfDivisors(int n)
+// a non-trivial factor of an odd composite n
+ull pollardRho(ull n)
 {
-    vector<int> primeNum;
-    map<int, int> Divisors;
-    for (auto it : primes)
+    thread_local mt19937_64 rng(20240607);
+    const ull M = 128; // gcd once per M steps
+    Montgomery mg(n);
+    while (true)
     {
-        if (1LL * it * it > n)
-            break;
-        if (n % it == 0)
+        ull c = rng() % (n - 1) + 1, y = rng() % n, x = y, ys = y, q = mg.to(1), g = 1;
+        auto f = [&](ull v)
         {
-
-            while (n % it == 0)
+            v = mg.mul(v, v) + c;
+            return v >= n ? v - n : v;
+        };
+        for (ull r = 1; g == 1; r <<= 1)
+        {
+            x = y;
+            for (ull i = 0; i < r; i++)
+                y = f(y);
+            for (ull k = 0; k < r && g == 1; k += M)
             {
-                // primeNum.push_back(it);
-                Divisors[it]++;
-                n /= it;
+                ys = y;
+                for (ull i = 0; i < min(M, r - k); i++)
+                {
+                    y = f(y);
+                    q = mg.mul(q, x > y ? x - y : y - x);
+                }
+                g = __gcd(q, n);
             }
         }
+        if (g == n)
+        {
+            // the batch overshot, redo it one step at a time
+            do
+            {
+                ys = f(ys);
+                g = __gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+        if (g != n)
+            return g;
+    }
+}
+void splitFactor(ull n, vector<ull> &out)
+{
+    if (n == 1)
+        return;
+    if (millerRabin(n))
+    {
+        out.push_back(n);
+        return;
+    }
+    ull d = pollardRho(n);
+    splitFactor(d, out);
+    splitFactor(n / d, out);
+}
+// (prime, exponent) pairs of any n >= 1 in increasing order. Primes below
+// TRIAL_LIMIT come off by trial division over the compile-time list, so
+// Pollard rho only ever sees the large factors.
+const int TRIAL_LIMIT = 1 << 10;
+vector<pair<ll, int>> factorize64(ll n)
+{
+    vector<ull> f;
+    for (int k = 0; k < smallSeive.primeCount; k++)
+    {
+        ll p = smallPrimes.p[k];
+        if (p >= TRIAL_LIMIT || p * p > n)
+            break;
+        while (n % p == 0)
+        {
+            f.push_back(p);
+            n /= p;
+        }
+    }
+    if (n > 1 && n < TRIAL_LIMIT * TRIAL_LIMIT)
+        f.push_back(n);
+    else
+        splitFactor(n, f);
+    sort(f.begin(), f.end());
+    vector<pair<ll, int>> res;
+    for (ull p : f)
+    {
+        if (!res.empty() && res.back().first == (ll)p)
+            res.back().second++;
+        else
+            res.push_back({(ll)p, 1});
+    }
+    return res;
+}
+// (prime, exponent) pairs of 1 <= n <= SMALL_LIMIT straight from the compile-time table
+vector<pair<ll, int>> staticFactorize(int n)
+{
+    vector<pair<ll, int>> res;
+    while (n > 1)
+    {
+        int p = smallSeive.spf[n] ? smallSeive.spf[n] : n;
+        int cnt = 0;
+        while (n % p == 0)
+        {
+            cnt++;
+            n /= p;
+        }
+        res.push_back({p, cnt});
+    }
+    return res;
+}
+// nodTable[n] = d(n), filled from the SPF table in one pass
+vector<uint16_t> nodTable;
+void buildNodTable(int n)
+{
+    vector<uint8_t> expo(n + 1, 0); // exponent of the smallest prime factor
+    nodTable.assign(n + 1, 1);
+    for (int i = 2; i <= n; i++)
+    {
+        if (!spfIdx[i])
+        {
+            expo[i] = 1;
+            nodTable[i] = 2;
+            continue;
+        }
+        int p = spfPrimes[spfIdx[i] - 1], m = i / p;
+        if (m % p == 0)
+        {
+            expo[i] = expo[m] + 1;
+            nodTable[i] = nodTable[m] / (expo[m] + 1) * (expo[i] + 1);
+        }
+        else
+        {
+            expo[i] = 1;
+            nodTable[i] = nodTable[m] * 2;
+        }
+    }
+}
+// The runtime tables are only built once a query falls between the two bounds.
+// They are written once to CACHE_FILE and mmap-ed on later runs, so startup
+// costs page faults instead of the sieve. File layout: CacheHeader, spfIdx and
+// nodTable as uint16 arrays of bound + 1 entries, then spfPrimes as int32.
+const int TABLE_LIMIT = 1e7;
+const char *CACHE_FILE = "nod_tables_cache.bin";
+const uint32_t CACHE_MAGIC = 0x444f4e54; // "TNOD"
+const uint32_t CACHE_VERSION = 1;
+struct CacheHeader
+{
+    uint32_t magic, version;
+    uint64_t bound, primeCount, checksum;
+};
+// Either point into the vectors filled above or into the mapped file
+const uint16_t *spfData = nullptr, *nodData = nullptr;
+const int *spfPrimeData = nullptr;
+uint64_t cacheChecksum(const char *p, size_t bytes)
+{
+    uint64_t h = 14695981039346656037ULL; // FNV-1a over 64-bit words, then the tail bytes
+    size_t i = 0;
+    for (uint64_t w; i + 8 <= bytes; i += 8)
+    {
+        memcpy(&w, p + i, 8);
+        h = (h ^ w) * 1099511628211ULL;
+    }
+    for (; i < bytes; i++)
+        h = (h ^ (uint8_t)p[i]) * 1099511628211ULL;
+    return h;
+}
+bool loadCache(int limit)
+{
+    int fd = open(CACHE_FILE, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(CacheHeader))
+    {
+        close(fd);
+        return false;
+    }
+    size_t size = st.st_size;
+    void *base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        return false;
+    const CacheHeader *h = (const CacheHeader *)base;
+    size_t entries = (size_t)limit + 1;
+    bool ok = h->magic == CACHE_MAGIC && h->version == CACHE_VERSION && h->bound == (uint64_t)limit &&
+              size == sizeof(CacheHeader) + entries * 4 + h->primeCount * 4 &&
+              cacheChecksum((const char *)(h + 1), size - sizeof(CacheHeader)) == h->checksum;
+    if (ok)
+    {
+        spfData = (const uint16_t *)(h + 1);
+        nodData = spfData + entries;
+        spfPrimeData = (const int *)(nodData + entries);
+    }
+    else
+        munmap(base, size);
+    return ok;
+}
+void saveCache(int limit)
+{
+    string body;
+    body.append((const char *)spfIdx.data(), spfIdx.size() * 2);
+    body.append((const char *)nodTable.data(), nodTable.size() * 2);
+    body.append((const char *)spfPrimes.data(), spfPrimes.size() * 4);
+    CacheHeader h = {CACHE_MAGIC, CACHE_VERSION, (uint64_t)limit, spfPrimes.size(), cacheChecksum(body.data(), body.size())};
+    // write to a temporary name and rename, so a crash never leaves a half written cache
+    string tmp = string(CACHE_FILE) + ".tmp";
+    FILE *out = fopen(tmp.c_str(), "wb");
+    if (!out)
+        return;
+    bool ok = fwrite(&h, sizeof(h), 1, out) == 1 && fwrite(body.data(), 1, body.size(), out) == body.size();
+    ok = (fclose(out) == 0) && ok;
+    if (ok)
+        rename(tmp.c_str(), CACHE_FILE);
+    else
+        remove(tmp.c_str());
+}
+// Load the tables for [0, TABLE_LIMIT] from the cache, rebuilding them if the
+// file is missing, from another version or bound, or fails the checksum.
+void initTables()
+{
+    if (!loadCache(TABLE_LIMIT))
+    {
+        linearSeive(TABLE_LIMIT);
+        buildNodTable(TABLE_LIMIT);
+        saveCache(TABLE_LIMIT);
+        spfData = spfIdx.data();
+        nodData = nodTable.data();
+        spfPrimeData = spfPrimes.data();
+    }
+}
+// (prime, exponent) pairs of n in increasing order. O(number of prime factors)
+// inside the tables, Pollard rho above them.
+vector<pair<ll, int>> factorize(ll n)
+{
+    if (n <= SMALL_LIMIT)
+        return staticFactorize(n);
+    if (n > TABLE_LIMIT)
+        return factorize64(n);
+    if (!spfData)
+        initTables();
+    vector<pair<ll, int>> res;
+    while (n > 1)
+    {
+        ll p = spfData[n] ? spfPrimeData[spfData[n] - 1] : n;
+        int cnt = 0;
+        while (n % p == 0)
+        {
+            cnt++;
+            n /= p;
+        }
+        res.push_back({p, cnt});
+    }
+    return res;
+}
+// Way 1
+map<int, int> NumOfDivisors(int n)
+{
+    map<int, int> Divisors;
+    for (auto it : factorize(n))
+    {
+        Divisors[it.first] += it.second;
     }
-    if (n > 1)
-        Divisors[n]++;
     return Divisors;
 }
 // Way 2
 ll NOD(ll n)
 {
     ll nod = 1;
-    for (auto it : primes)
+    for (auto it : factorize(n))
     {
-        if (1LL * it * it > n)
-            break;
-        if (n % it == 0)
+        nod *= (it.second + 1);
+    }
+    return nod;
+}
+// NOD for n inside the tables, without building a factor list
+ll NODTable(ll n)
+{
+    if (nodData)
+        return nodData[n];
+    ll nod = 1;
+    while (n > 1)
+    {
+        ll p = smallSeive.spf[n] ? smallSeive.spf[n] : n;
+        int cnt = 0;
+        while (n % p == 0)
+        {
+            cnt++;
+            n /= p;
+        }
+        nod *= (cnt + 1);
+    }
+    return nod;
+}
+// Batch mode: the whole input is read with one fread and parsed by hand, and
+// the answers are written back the same way, in input order.
+// Text input: t followed by t numbers. With --binary: a uint64 count followed
+// by that many uint64 queries, answered as raw int64 values.
+vector<char> readAll()
+{
+    vector<char> buf;
+    char chunk[1 << 16];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), stdin)) > 0)
+    {
+        buf.insert(buf.end(), chunk, chunk + got);
+    }
+    return buf;
+}
+// factorize64 works in signed 64-bit, so larger queries are refused
+const ull MAX_N = LLONG_MAX;
+vector<ull> readQueries(bool binary)
+{
+    vector<char> buf = readAll();
+    vector<ull> q;
+    if (binary)
+    {
+        ull t = 0;
+        if (buf.size() >= 8)
+            memcpy(&t, buf.data(), 8);
+        t = min<ull>(t, (buf.size() - min<size_t>(buf.size(), 8)) / 8);
+        q.resize(t);
+        if (t)
+            memcpy(q.data(), buf.data() + 8, t * 8);
+        return q;
+    }
+    size_t pos = 0;
+    auto next = [&](ull &x)
+    {
+        while (pos < buf.size() && (buf[pos] < '0' || buf[pos] > '9'))
+            pos++;
+        if (pos == buf.size())
+            return false;
+        bool negative = pos > 0 && buf[pos - 1] == '-';
+        x = 0;
+        while (pos < buf.size() && buf[pos] >= '0' && buf[pos] <= '9')
+        {
+            // anything past MAX_N is clamped to MAX_N + 1 and rejected in main
+            x = x > MAX_N / 10 ? MAX_N + 1 : x * 10 + (buf[pos] - '0');
+            pos++;
+        }
+        if (negative)
+            x = MAX_N + 1; // no valid query is negative
+        return true;
+    };
+    ull t = 0, x;
+    next(t);
+    q.reserve(min<ull>(t, buf.size() / 2 + 1));
+    while (q.size() < t && next(x))
+    {
+        q.push_back(x);
+    }
+    return q;
+}
+void writeAnswers(const vector<ll> &ans, bool binary)
+{
+    if (binary)
+    {
+        fwrite(ans.data(), 8, ans.size(), stdout);
+        return;
+    }
+    string out;
+    out.reserve(ans.size() * 8);
+    char tmp[24];
+    for (ll v : ans)
+    {
+        char *end = to_chars(tmp, tmp + sizeof(tmp), v).ptr;
+        out.append(tmp, end);
+        out.push_back(nline);
+    }
+    fwrite(out.data(), 1, out.size(), stdout);
+}
+// Run solve(i) for every index in idx on all cores, chunk indices at a time
+template <typename F>
+void parallelFor(const vector<int> &idx, size_t chunk, F solve)
+{
+    atomic<size_t> pos(0);
+    auto worker = [&]()
+    {
+        for (size_t s; (s = pos.fetch_add(chunk)) < idx.size();)
         {
-            ll cnt = 0;
-            while (n % it == 0)
+            for (size_t k = s; k < min(idx.size(), s + chunk); k++)
             {
-                // primeNum.push_back(it);
-                cnt++;
-                n /= it;
+                solve(idx[k]);
             }
-            nod *= (cnt + 1);
         }
+    };
+    int threads = max(1u, thread::hardware_concurrency());
+    threads = min<size_t>(threads, idx.size() / chunk + 1);
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++)
+    {
+        pool.emplace_back(worker);
     }
-    if (n > 1)
-        nod *= 1LL * 2;
-    return nod;
+    worker();
+    for (auto &th : pool)
+    {
+        th.join();
+    }
+}
+// Table lookups and Pollard rho queries are answered as two separate groups,
+// big chunks for the cheap ones and small chunks for the expensive ones.
+vector<ll> solveBatch(const vector<ull> &q)
+{
+    vector<ll> ans(q.size());
+    vector<int> cheap, heavy;
+    bool needTables = false;
+    for (int i = 0; i < (int)q.size(); i++)
+    {
+        if (q[i] <= (ull)TABLE_LIMIT)
+        {
+            cheap.push_back(i);
+            needTables |= q[i] > (ull)SMALL_LIMIT;
+        }
+        else
+            heavy.push_back(i);
+    }
+    if (needTables && !spfData)
+        initTables();
+    parallelFor(cheap, 1 << 14, [&](int i)
+                { ans[i] = NODTable(q[i]); });
+    parallelFor(heavy, 16, [&](int i)
+                { ans[i] = NOD(q[i]); });
+    return ans;
 }
-int main()
+int main(int argc, char **argv)
 {
-    Fast;
-    int limit = 1e7;
-    seive(limit);
-    int t;
-    cin >> t;
-    while (t--)
+    bool binary = argc > 1 && string(argv[1]) == "--binary";
+    vector<ull> q = readQueries(binary);
+    if (any_of(q.begin(), q.end(), [](ull x)
+               { return x > MAX_N; }))
     {
-        ll n;
-        cin >> n;
-        cout << NOD(n) << nline;
+        cout << "n must be between 0 and " << MAX_N << nline;
+        return 1;
     }
+    writeAnswers(solveBatch(q), binary);
     // map<int, int> ans = NumOfDivisors(n);
     // ll num = 1;
     // for (auto u : ans)
@@ -110,4 +596,4 @@ int main()
     // }
     // cout << num << nline;
     return 0;
-}
\ No newline at end of file
+}
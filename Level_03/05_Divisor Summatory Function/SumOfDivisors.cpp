@@ -15,19 +15,154 @@ using namespace std;
     }                      \
     cout << endl;
 
+typedef unsigned long long ull;
+typedef unsigned __int128 u128;
+
+string toString(u128 x)
+{
+    if (x == 0)
+        return "0";
+    string s;
+    while (x)
+    {
+        s += char('0' + x % 10);
+        x /= 10;
+    }
+    reverse(s.begin(), s.end());
+    return s;
+}
+// floor(sqrt(n)) for any 64-bit n; the checks divide instead of squaring,
+// since (r + 1)^2 overflows once n >= (2^32 - 1)^2
+ull isqrt(ull n)
+{
+    ull r = sqrtl(n);
+    while (r > 0 && r > n / r)
+        r--;
+    while (r + 1 <= n / (r + 1))
+        r++;
+    return r;
+}
+// D(n) = d(1) + ... + d(n) = sum of n / i. Hyperbola method: count the
+// lattice points under xy = n with x <= sqrt(n), double it and remove the
+// sqrt(n) x sqrt(n) square counted twice. O(sqrt n).
+u128 divisorSummatory(ull n)
+{
+    ull sq = isqrt(n);
+    u128 snod = 0;
+    for (ull i = 1; i <= sq; i++)
+    {
+        snod += n / i;
+    }
+    return snod * 2 - (u128)sq * sq;
+}
+// Same D(n) in about O(n^(1/3)) by walking the convex hull of the lattice
+// points under the hyperbola: the boundary is followed with Stern-Brocot
+// slopes (a stack of (dx, dy) steps), so each straight run of points is
+// added in O(1). Only the last ~n^(1/3) columns are summed directly.
+u128 divisorSummatoryFast(ull n)
+{
+    if (n < 1000)
+        return divisorSummatory(n);
+    auto outside = [n](ull x, ull y)
+    { return (u128)x * y > n; };
+    // the hyperbola's slope at x is already steeper than dy / dx
+    auto cut = [n](ull x, ull dx, ull dy)
+    { return (u128)x * x * dy >= (u128)n * dx; };
+    ull sq = isqrt(n), cb = pow((long double)n, 0.35L);
+    ull x = n / sq, y = n / x + 1;
+    u128 res = 0;
+    vector<pair<ull, ull>> st = {{1, 0}, {1, 1}};
+    while (true)
+    {
+        auto [lx, ly] = st.back();
+        st.pop_back();
+        while (outside(x + lx, y - ly))
+        {
+            res += (u128)x * ly + (u128)(ly + 1) * (lx - 1) / 2;
+            x += lx;
+            y -= ly;
+        }
+        if (y <= cb)
+            break;
+        ull rx = lx, ry = ly;
+        while (true)
+        {
+            tie(lx, ly) = st.back();
+            if (outside(x + lx, y - ly))
+                break;
+            rx = lx, ry = ly;
+            st.pop_back();
+        }
+        while (true)
+        {
+            ull mx = lx + rx, my = ly + ry;
+            if (outside(x + mx, y - my))
+            {
+                st.push_back({lx = mx, ly = my});
+            }
+            else
+            {
+                if (cut(x + mx, lx, ly))
+                    break;
+                rx = mx, ry = my;
+            }
+        }
+    }
+    for (--y; y > 0; --y)
+    {
+        res += n / y;
+    }
+    return res * 2 - (u128)sq * sq;
+}
+// S(n) = sigma(1) + ... + sigma(n) = sum of i * (n / i), by the same hyperbola:
+// pairs (a, b) with ab <= n weighted by a, split at sqrt(n). O(sqrt n).
+u128 tri(ull m) // 1 + 2 + ... + m
+{
+    return (u128)m * (m + 1) / 2;
+}
+u128 sigmaSummatory(ull n)
+{
+    ull sq = isqrt(n);
+    u128 res = 0;
+    for (ull i = 1; i <= sq; i++)
+    {
+        res += (u128)i * (n / i) + tri(n / i);
+    }
+    return res - tri(sq) * sq;
+}
+// Batch versions: answers in input order, each query on its own
+vector<u128> divisorSummatoryBatch(const vector<ull> &qs)
+{
+    vector<u128> res;
+    res.reserve(qs.size());
+    for (ull n : qs)
+    {
+        res.push_back(divisorSummatoryFast(n));
+    }
+    return res;
+}
+vector<u128> sigmaSummatoryBatch(const vector<ull> &qs)
+{
+    vector<u128> res;
+    res.reserve(qs.size());
+    for (ull n : qs)
+    {
+        res.push_back(sigmaSummatory(n));
+    }
+    return res;
+}
 int main()
 {
     Fast;
-    int n;
-    cin >> n;
-    int sq = sqrt(n);
-    int SNOD = 0;
-    for (int i = 1; i <= sq; i++)
+    vector<ull> qs;
+    ull n;
+    while (cin >> n)
+    {
+        qs.push_back(n);
+    }
+    for (u128 SNOD : divisorSummatoryBatch(qs))
     {
-        SNOD += (n / i) - i;
+        cout << toString(SNOD) << nline;
     }
-    SNOD *= 2;
-    SNOD += sq;
-    cout << SNOD << nline;
     return 0;
-}
\ No newline at end of file
+}
@@ -15,71 +15,397 @@ using namespace std;
     }                      \
     cout << endl;
 
-const int N = 1e8 + 123;
-bitset<N> isPrime;
-vector<int> primes;
-void seive(int N)
+// Sieve run by the compiler: smallest prime factors and the primes up to LIMIT
+// are baked into the binary, so inputs up to LIMIT need no runtime sieve.
+// spf[n] = 0 means n is prime. Bounds past ~2.6e5 need -fconstexpr-loop-limit.
+template <int LIMIT>
+struct StaticSeive
 {
-    for (int i = 3; i <= N; i += 2)
+    uint16_t spf[LIMIT + 1] = {};
+    int primeCount = 0;
+    constexpr StaticSeive()
     {
-        isPrime[i] = true;
+        for (int i = 2; i * i <= LIMIT; i++)
+        {
+            if (spf[i] == 0)
+            {
+                for (int j = i * i; j <= LIMIT; j += i)
+                {
+                    if (spf[j] == 0)
+                        spf[j] = i;
+                }
+            }
+        }
+        for (int i = 2; i <= LIMIT; i++)
+        {
+            primeCount += (spf[i] == 0);
+        }
+    }
+};
+template <int LIMIT, int COUNT>
+struct StaticPrimeList
+{
+    int p[COUNT] = {};
+    constexpr StaticPrimeList(const StaticSeive<LIMIT> &s)
+    {
+        for (int i = 2, k = 0; i <= LIMIT; i++)
+        {
+            if (s.spf[i] == 0)
+                p[k++] = i;
+        }
+    }
+};
+const int SMALL_LIMIT = 1 << 16;
+constexpr StaticSeive<SMALL_LIMIT> smallSeive;
+constexpr StaticPrimeList<SMALL_LIMIT, smallSeive.primeCount> smallPrimes(smallSeive);
+// 64-bit factorization: deterministic Miller-Rabin and Brent's Pollard rho.
+// Both work in Montgomery form, so the hot loops multiply without any
+// 128-bit division. Valid for odd moduli below 2^63.
+typedef unsigned long long ull;
+struct Montgomery
+{
+    ull n, nInv, r2; // nInv = n^-1 mod 2^64, r2 = 2^128 mod n
+    Montgomery(ull n) : n(n)
+    {
+        nInv = n;
+        for (int i = 0; i < 5; i++)
+            nInv *= 2 - n * nInv;
+        ull r = -n % n;
+        r2 = (unsigned __int128)r * r % n;
+    }
+    ull reduce(unsigned __int128 x) const // x / 2^64 mod n
+    {
+        ull q = (ull)x * nInv;
+        ull m = ((unsigned __int128)q * n) >> 64;
+        ull hi = x >> 64;
+        return hi >= m ? hi - m : hi + n - m;
+    }
+    ull to(ull a) const { return reduce((unsigned __int128)(a % n) * r2); }
+    ull from(ull a) const { return reduce(a); }
+    ull mul(ull a, ull b) const { return reduce((unsigned __int128)a * b); }
+    ull pow(ull a, ull e) const
+    {
+        ull res = to(1);
+        while (e)
+        {
+            if (e & 1)
+                res = mul(res, a);
+            a = mul(a, a);
+            e >>= 1;
+        }
+        return res;
+    }
+};
+bool millerRabin(ull n)
+{
+    if (n < 2)
+        return false;
+    for (ull p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+    {
+        if (n % p == 0)
+            return n == p;
     }
-    for (int i = 3; i <= sqrt(N); i += 2)
+    Montgomery mg(n);
+    ull one = mg.to(1), minusOne = mg.to(n - 1);
+    ull d = n - 1;
+    int s = __builtin_ctzll(d);
+    d >>= s;
+    // this witness set is exact for every n < 2^64
+    for (ull a : {2, 325, 9375, 28178, 450775, 9780504, 1795265022})
     {
-        if (isPrime[i] == true)
+        if (a % n == 0)
+            continue;
+        ull x = mg.pow(mg.to(a), d);
+        if (x == one || x == minusOne)
+            continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; r++)
         {
-            for (int j = i * 2; j <= N; j += i)
+            x = mg.mul(x, x);
+            composite = (x != minusOne);
+        }
+        if (composite)
+            return false;
+    }
+    return true;
+}
+// a non-trivial factor of an odd composite n
+ull pollardRho(ull n)
+{
+    thread_local mt19937_64 rng(20240607);
+    const ull M = 128; // gcd once per M steps
+    Montgomery mg(n);
+    while (true)
+    {
+        ull c = rng() % (n - 1) + 1, y = rng() % n, x = y, ys = y, q = mg.to(1), g = 1;
+        auto f = [&](ull v)
+        {
+            v = mg.mul(v, v) + c;
+            return v >= n ? v - n : v;
+        };
+        for (ull r = 1; g == 1; r <<= 1)
+        {
+            x = y;
+            for (ull i = 0; i < r; i++)
+                y = f(y);
+            for (ull k = 0; k < r && g == 1; k += M)
             {
-                isPrime[j] = false;
+                ys = y;
+                for (ull i = 0; i < min(M, r - k); i++)
+                {
+                    y = f(y);
+                    q = mg.mul(q, x > y ? x - y : y - x);
+                }
+                g = __gcd(q, n);
             }
         }
+        if (g == n)
+        {
+            // the batch overshot, redo it one step at a time
+            do
+            {
+                ys = f(ys);
+                g = __gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+        if (g != n)
+            return g;
+    }
+}
+void splitFactor(ull n, vector<ull> &out)
+{
+    if (n == 1)
+        return;
+    if (millerRabin(n))
+    {
+        out.push_back(n);
+        return;
+    }
+    ull d = pollardRho(n);
+    splitFactor(d, out);
+    splitFactor(n / d, out);
+}
+// (prime, exponent) pairs of any n >= 1 in increasing order. Primes below
+// TRIAL_LIMIT come off by trial division over the compile-time list, so
+// Pollard rho only ever sees the large factors.
+const int TRIAL_LIMIT = 1 << 10;
+vector<pair<ll, int>> factorize64(ll n)
+{
+    vector<ull> f;
+    for (int k = 0; k < smallSeive.primeCount; k++)
+    {
+        ll p = smallPrimes.p[k];
+        if (p >= TRIAL_LIMIT || p * p > n)
+            break;
+        while (n % p == 0)
+        {
+            f.push_back(p);
+            n /= p;
+        }
+    }
+    if (n > 1 && n < TRIAL_LIMIT * TRIAL_LIMIT)
+        f.push_back(n);
+    else
+        splitFactor(n, f);
+    sort(f.begin(), f.end());
+    vector<pair<ll, int>> res;
+    for (ull p : f)
+    {
+        if (!res.empty() && res.back().first == (ll)p)
+            res.back().second++;
+        else
+            res.push_back({(ll)p, 1});
     }
-    primes.push_back(2);
-    for (int i = 3; i <= N; i += 2)
+    return res;
+}
+// (prime, exponent) pairs of 1 <= n <= SMALL_LIMIT straight from the compile-time table
+vector<pair<ll, int>> staticFactorize(int n)
+{
+    vector<pair<ll, int>> res;
+    while (n > 1)
     {
-        if (isPrime[i])
-            primes.push_back(i);
+        int p = smallSeive.spf[n] ? smallSeive.spf[n] : n;
+        int cnt = 0;
+        while (n % p == 0)
+        {
+            cnt++;
+            n /= p;
+        }
+        res.push_back({p, cnt});
     }
+    return res;
 }
 ll SOD(ll n)
 {
     ll snod = 1;
-    for (auto it : primes)
+    for (auto it : n <= SMALL_LIMIT ? staticFactorize(n) : factorize64(n))
     {
-        if (1LL * it * it > n)
-            break;
-        if (n % it == 0)
+        ll a = 1;
+        ll sum = 1;
+        for (int k = 0; k < it.second; k++)
+        {
+            a *= it.first;
+            sum += a;
+        }
+        snod *= sum;
+    }
+    return snod;
+}
+// SOD for n <= SMALL_LIMIT, without building a factor list
+ll SODTable(ll n)
+{
+    ll snod = 1;
+    while (n > 1)
+    {
+        ll p = smallSeive.spf[n] ? smallSeive.spf[n] : n;
+        ll a = 1;
+        ll sum = 1;
+        while (n % p == 0)
+        {
+            a *= p;
+            sum += a;
+            n /= p;
+        }
+        snod *= sum;
+    }
+    return snod;
+}
+// Batch mode: the whole input is read with one fread and parsed by hand, and
+// the answers are written back the same way, in input order.
+// Text input: t followed by t numbers. With --binary: a uint64 count followed
+// by that many uint64 queries, answered as raw int64 values.
+vector<char> readAll()
+{
+    vector<char> buf;
+    char chunk[1 << 16];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), stdin)) > 0)
+    {
+        buf.insert(buf.end(), chunk, chunk + got);
+    }
+    return buf;
+}
+// sigma(n) < 6.7 n up to here (Robin's bound), so SOD(n) fits in an int64
+const ull MAX_N = 1e18;
+vector<ull> readQueries(bool binary)
+{
+    vector<char> buf = readAll();
+    vector<ull> q;
+    if (binary)
+    {
+        ull t = 0;
+        if (buf.size() >= 8)
+            memcpy(&t, buf.data(), 8);
+        t = min<ull>(t, (buf.size() - min<size_t>(buf.size(), 8)) / 8);
+        q.resize(t);
+        if (t)
+            memcpy(q.data(), buf.data() + 8, t * 8);
+        return q;
+    }
+    size_t pos = 0;
+    auto next = [&](ull &x)
+    {
+        while (pos < buf.size() && (buf[pos] < '0' || buf[pos] > '9'))
+            pos++;
+        if (pos == buf.size())
+            return false;
+        bool negative = pos > 0 && buf[pos - 1] == '-';
+        x = 0;
+        while (pos < buf.size() && buf[pos] >= '0' && buf[pos] <= '9')
         {
-            ll a = 1;
-            ll sum = 1;
-            while (n % it == 0)
+            // anything past MAX_N is clamped to MAX_N + 1 and rejected in main
+            x = x > MAX_N / 10 ? MAX_N + 1 : x * 10 + (buf[pos] - '0');
+            pos++;
+        }
+        if (negative)
+            x = MAX_N + 1; // no valid query is negative
+        return true;
+    };
+    ull t = 0, x;
+    next(t);
+    q.reserve(min<ull>(t, buf.size() / 2 + 1));
+    while (q.size() < t && next(x))
+    {
+        q.push_back(x);
+    }
+    return q;
+}
+void writeAnswers(const vector<ll> &ans, bool binary)
+{
+    if (binary)
+    {
+        fwrite(ans.data(), 8, ans.size(), stdout);
+        return;
+    }
+    string out;
+    out.reserve(ans.size() * 8);
+    char tmp[24];
+    for (ll v : ans)
+    {
+        char *end = to_chars(tmp, tmp + sizeof(tmp), v).ptr;
+        out.append(tmp, end);
+        out.push_back(nline);
+    }
+    fwrite(out.data(), 1, out.size(), stdout);
+}
+// Run solve(i) for every index in idx on all cores, chunk indices at a time
+template <typename F>
+void parallelFor(const vector<int> &idx, size_t chunk, F solve)
+{
+    atomic<size_t> pos(0);
+    auto worker = [&]()
+    {
+        for (size_t s; (s = pos.fetch_add(chunk)) < idx.size();)
+        {
+            for (size_t k = s; k < min(idx.size(), s + chunk); k++)
             {
-                a *= it;
-                sum += a;
-                n /= it;
+                solve(idx[k]);
             }
-            snod *= sum;
         }
+    };
+    int threads = max(1u, thread::hardware_concurrency());
+    threads = min<size_t>(threads, idx.size() / chunk + 1);
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++)
+    {
+        pool.emplace_back(worker);
     }
-    if (n > 1)
+    worker();
+    for (auto &th : pool)
     {
-        snod *= (1 + n);
+        th.join();
     }
-    return snod;
 }
-int main()
+// Table lookups and Pollard rho queries are answered as two separate groups,
+// big chunks for the cheap ones and small chunks for the expensive ones.
+// Each answer is the sum of proper divisors, SOD(n) - n.
+vector<ll> solveBatch(const vector<ull> &q)
 {
-    Fast;
-    int limit = 1e8;
-    seive(limit);
-    int t;
-    cin >> t;
-    while (t--)
+    vector<ll> ans(q.size());
+    vector<int> cheap, heavy;
+    for (int i = 0; i < (int)q.size(); i++)
     {
-        ll n;
-        cin >> n;
-        ll ans = SOD(n);
-        cout << ans - n << nline;
+        if (q[i] <= (ull)SMALL_LIMIT)
+            cheap.push_back(i);
+        else
+            heavy.push_back(i);
     }
+    parallelFor(cheap, 1 << 14, [&](int i)
+                { ans[i] = SODTable(q[i]) - (ll)q[i]; });
+    parallelFor(heavy, 16, [&](int i)
+                { ans[i] = SOD(q[i]) - (ll)q[i]; });
+    return ans;
+}
+int main(int argc, char **argv)
+{
+    bool binary = argc > 1 && string(argv[1]) == "--binary";
+    vector<ull> q = readQueries(binary);
+    if (any_of(q.begin(), q.end(), [](ull x)
+               { return x > MAX_N; }))
+    {
+        cout << "n must be between 0 and " << MAX_N << nline;
+        return 1;
+    }
+    writeAnswers(solveBatch(q), binary);
     return 0;
-}
\ No newline at end of file
+}
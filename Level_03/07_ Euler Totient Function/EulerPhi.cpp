@@ -15,61 +15,239 @@ using namespace std;
     }                      \
     cout << endl;
 
-const int N = 1e7 + 123;
-bitset<N> isPrime;
-vector<int> primes;
-void seive(int N)
+// Sieve run by the compiler: smallest prime factors and the primes up to LIMIT
+// are baked into the binary, so inputs up to LIMIT need no runtime sieve.
+// spf[n] = 0 means n is prime. Bounds past ~2.6e5 need -fconstexpr-loop-limit.
+template <int LIMIT>
+struct StaticSeive
 {
-    for (int i = 3; i <= N; i += 2)
+    uint16_t spf[LIMIT + 1] = {};
+    int primeCount = 0;
+    constexpr StaticSeive()
     {
-        isPrime[i] = true;
+        for (int i = 2; i * i <= LIMIT; i++)
+        {
+            if (spf[i] == 0)
+            {
+                for (int j = i * i; j <= LIMIT; j += i)
+                {
+                    if (spf[j] == 0)
+                        spf[j] = i;
+                }
+            }
+        }
+        for (int i = 2; i <= LIMIT; i++)
+        {
+            primeCount += (spf[i] == 0);
+        }
+    }
+};
+template <int LIMIT, int COUNT>
+struct StaticPrimeList
+{
+    int p[COUNT] = {};
+    constexpr StaticPrimeList(const StaticSeive<LIMIT> &s)
+    {
+        for (int i = 2, k = 0; i <= LIMIT; i++)
+        {
+            if (s.spf[i] == 0)
+                p[k++] = i;
+        }
+    }
+};
+const int SMALL_LIMIT = 1 << 16;
+constexpr StaticSeive<SMALL_LIMIT> smallSeive;
+constexpr StaticPrimeList<SMALL_LIMIT, smallSeive.primeCount> smallPrimes(smallSeive);
+// 64-bit factorization: deterministic Miller-Rabin and Brent's Pollard rho.
+// Both work in Montgomery form, so the hot loops multiply without any
+// 128-bit division. Valid for odd moduli below 2^63.
+typedef unsigned long long ull;
+struct Montgomery
+{
+    ull n, nInv, r2; // nInv = n^-1 mod 2^64, r2 = 2^128 mod n
+    Montgomery(ull n) : n(n)
+    {
+        nInv = n;
+        for (int i = 0; i < 5; i++)
+            nInv *= 2 - n * nInv;
+        ull r = -n % n;
+        r2 = (unsigned __int128)r * r % n;
+    }
+    ull reduce(unsigned __int128 x) const // x / 2^64 mod n
+    {
+        ull q = (ull)x * nInv;
+        ull m = ((unsigned __int128)q * n) >> 64;
+        ull hi = x >> 64;
+        return hi >= m ? hi - m : hi + n - m;
     }
-    for (int i = 3; i <= sqrt(N); i += 2)
+    ull to(ull a) const { return reduce((unsigned __int128)(a % n) * r2); }
+    ull from(ull a) const { return reduce(a); }
+    ull mul(ull a, ull b) const { return reduce((unsigned __int128)a * b); }
+    ull pow(ull a, ull e) const
     {
-        if (isPrime[i] == true)
+        ull res = to(1);
+        while (e)
         {
-            for (int j = i * 2; j <= N; j += i)
+            if (e & 1)
+                res = mul(res, a);
+            a = mul(a, a);
+            e >>= 1;
+        }
+        return res;
+    }
+};
+bool millerRabin(ull n)
+{
+    if (n < 2)
+        return false;
+    for (ull p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+    {
+        if (n % p == 0)
+            return n == p;
+    }
+    Montgomery mg(n);
+    ull one = mg.to(1), minusOne = mg.to(n - 1);
+    ull d = n - 1;
+    int s = __builtin_ctzll(d);
+    d >>= s;
+    // this witness set is exact for every n < 2^64
+    for (ull a : {2, 325, 9375, 28178, 450775, 9780504, 1795265022})
+    {
+        if (a % n == 0)
+            continue;
+        ull x = mg.pow(mg.to(a), d);
+        if (x == one || x == minusOne)
+            continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; r++)
+        {
+            x = mg.mul(x, x);
+            composite = (x != minusOne);
+        }
+        if (composite)
+            return false;
+    }
+    return true;
+}
+// a non-trivial factor of an odd composite n
+ull pollardRho(ull n)
+{
+    thread_local mt19937_64 rng(20240607);
+    const ull M = 128; // gcd once per M steps
+    Montgomery mg(n);
+    while (true)
+    {
+        ull c = rng() % (n - 1) + 1, y = rng() % n, x = y, ys = y, q = mg.to(1), g = 1;
+        auto f = [&](ull v)
+        {
+            v = mg.mul(v, v) + c;
+            return v >= n ? v - n : v;
+        };
+        for (ull r = 1; g == 1; r <<= 1)
+        {
+            x = y;
+            for (ull i = 0; i < r; i++)
+                y = f(y);
+            for (ull k = 0; k < r && g == 1; k += M)
             {
-                isPrime[j] = false;
+                ys = y;
+                for (ull i = 0; i < min(M, r - k); i++)
+                {
+                    y = f(y);
+                    q = mg.mul(q, x > y ? x - y : y - x);
+                }
+                g = __gcd(q, n);
             }
         }
+        if (g == n)
+        {
+            // the batch overshot, redo it one step at a time
+            do
+            {
+                ys = f(ys);
+                g = __gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+        if (g != n)
+            return g;
     }
-    primes.push_back(2);
-    for (int i = 3; i <= N; i += 2)
+}
+void splitFactor(ull n, vector<ull> &out)
+{
+    if (n == 1)
+        return;
+    if (millerRabin(n))
     {
-        if (isPrime[i])
-            primes.push_back(i);
+        out.push_back(n);
+        return;
     }
+    ull d = pollardRho(n);
+    splitFactor(d, out);
+    splitFactor(n / d, out);
 }
-ll EulerPhi(ll n)
+// (prime, exponent) pairs of any n >= 1 in increasing order. Primes below
+// TRIAL_LIMIT come off by trial division over the compile-time list, so
+// Pollard rho only ever sees the large factors.
+const int TRIAL_LIMIT = 1 << 10;
+vector<pair<ll, int>> factorize64(ll n)
 {
-    ll phi = n;
-    for (auto it : primes)
+    vector<ull> f;
+    for (int k = 0; k < smallSeive.primeCount; k++)
     {
-        if (1LL * it * it > n)
+        ll p = smallPrimes.p[k];
+        if (p >= TRIAL_LIMIT || p * p > n)
             break;
-        if (n % it == 0)
+        while (n % p == 0)
         {
-            while (n % it == 0)
-            {
-                n /= it;
-            }
-            phi /= it;
-            phi *= (it - 1);
+            f.push_back(p);
+            n /= p;
         }
     }
-    if (n > 1)
+    if (n > 1 && n < TRIAL_LIMIT * TRIAL_LIMIT)
+        f.push_back(n);
+    else
+        splitFactor(n, f);
+    sort(f.begin(), f.end());
+    vector<pair<ll, int>> res;
+    for (ull p : f)
+    {
+        if (!res.empty() && res.back().first == (ll)p)
+            res.back().second++;
+        else
+            res.push_back({(ll)p, 1});
+    }
+    return res;
+}
+// (prime, exponent) pairs of 1 <= n <= SMALL_LIMIT straight from the compile-time table
+vector<pair<ll, int>> staticFactorize(int n)
+{
+    vector<pair<ll, int>> res;
+    while (n > 1)
+    {
+        int p = smallSeive.spf[n] ? smallSeive.spf[n] : n;
+        int cnt = 0;
+        while (n % p == 0)
+        {
+            cnt++;
+            n /= p;
+        }
+        res.push_back({p, cnt});
+    }
+    return res;
+}
+ll EulerPhi(ll n)
+{
+    ll phi = n;
+    for (auto it : n <= SMALL_LIMIT ? staticFactorize(n) : factorize64(n))
     {
-        phi /= n;
-        phi*= (n-1);
+        phi /= it.first;
+        phi *= (it.first - 1);
     }
     return phi;
 }
 int main()
 {
     Fast;
-    int limit = 1e3;
-    seive(limit);
     ll n;
     cin >> n; // Phi(1) = 0
     cout << EulerPhi(n) << nline;
@@ -10,6 +10,140 @@ cout.tie(0);
 #define No cout<<"NO\n"
 #define print(v) for(auto &it : v){cout<< it<<' '; } cout<<endl;
 
+// Dirichlet toolkit over plain arrays indexed 1..N (index 0 is unused).
+//   dirichlet(f, g)   h(n) = sum_{d | n} f(d) g(n / d)          O(N log N)
+//   divisorSum(f)     f(n) <- sum_{d | n} f(d), i.e. f * 1        O(N log log N)
+//   mobiusInvert(f)   undoes divisorSum, i.e. f * mu              O(N log log N)
+// divisorSum walks prime by prime: after handling p, f(n) holds the sum over
+// the divisors of n that differ from n only in the primes done so far. For a
+// fixed p the chains i, ip, ip^2, ... (p does not divide i) are independent,
+// so each pass is split over threads by chain start.
+template <typename F>
+void parallelRanges(ll lo, ll hi, F work) // work(l, r) on [l, r]
+{
+    int threads = max(1u, thread::hardware_concurrency());
+    threads = min<ll>(threads, (hi - lo) / 4096 + 1);
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++)
+    {
+        ll l = lo + (hi - lo + 1) * t / threads, r = lo + (hi - lo + 1) * (t + 1) / threads - 1;
+        pool.emplace_back(work, l, r);
+    }
+    work(lo, lo + (hi - lo + 1) / threads - 1);
+    for (auto &th : pool)
+    {
+        th.join();
+    }
+}
+vector<int> primesUpTo(int n)
+{
+    vector<char> composite(n + 1, false);
+    vector<int> primes;
+    for (ll i = 2; i <= n; i++)
+    {
+        if (composite[i])
+            continue;
+        primes.push_back(i);
+        for (ll j = i * i; j <= n; j += i)
+        {
+            composite[j] = true;
+        }
+    }
+    return primes;
+}
+vector<ll> dirichlet(const vector<ll> &f, const vector<ll> &g)
+{
+    int n = min(f.size(), g.size()) - 1;
+    vector<ll> h(n + 1, 0);
+    // each thread owns the outputs in [l, r]
+    parallelRanges(1, n, [&](ll l, ll r)
+                   {
+        for (ll d = 1; d <= r; d++)
+        {
+            ll k = (l + d - 1) / d;
+            for (ll m = k * d; m <= r; m += d, k++)
+            {
+                h[m] += f[d] * g[k];
+            }
+        } });
+    return h;
+}
+template <typename Step>
+void primeChains(vector<ll> &f, Step step)
+{
+    int n = f.size() - 1;
+    for (int p : primesUpTo(n))
+    {
+        parallelRanges(1, n / p, [&](ll l, ll r)
+                       {
+            for (ll i = l; i <= r; i++)
+            {
+                if (i % p)
+                    step(i, p);
+            } });
+    }
+}
+void divisorSum(vector<ll> &f)
+{
+    int n = f.size() - 1;
+    primeChains(f, [&](ll i, int p)
+                {
+        for (ll m = i; m * p <= n; m *= p)
+        {
+            f[m * p] += f[m];
+        } });
+}
+void mobiusInvert(vector<ll> &f)
+{
+    int n = f.size() - 1;
+    primeChains(f, [&](ll i, int p)
+                {
+        ll top = i;
+        while (top * p <= n)
+        {
+            top *= p;
+        }
+        for (ll m = top; m > i; m /= p)
+        {
+            f[m] -= f[m / p];
+        } });
+}
+vector<ll> identity(int n)
+{
+    vector<ll> f(n + 1);
+    iota(f.begin(), f.end(), 0);
+    return f;
+}
+// id = phi * 1, so phi is the Mobius inversion of id
+vector<ll> totients(int n)
+{
+    vector<ll> phi = identity(n);
+    mobiusInvert(phi);
+    return phi;
+}
+// Pillai: sum_{a=1..n} gcd(a, n) = sum_{d | n} d * phi(n / d) = (id * phi)(n)
+vector<ll> gcdSums(int n)
+{
+    return dirichlet(identity(n), totients(n));
+}
+// sum_{i=1..n} lcm(i, n) = n / 2 * (1 + sum_{d | n} d * phi(d)), which
+// passes 2^63 around n = 2e6, so the sums are returned as u128
+typedef unsigned __int128 u128;
+vector<u128> lcmSums(int n)
+{
+    vector<ll> f = totients(n);
+    for (int i = 1; i <= n; i++)
+    {
+        f[i] *= i;
+    }
+    divisorSum(f);
+    vector<u128> res(n + 1, 0);
+    for (int i = 1; i <= n; i++)
+    {
+        res[i] = (u128)(f[i] + 1) * i / 2;
+    }
+    return res;
+}
 int main()
 {
     Fast;
@@ -17,6 +151,14 @@ int main()
     // solution : Phi(N/d);
     // when we divide two numbers with their gcd then they are coprime
     // gcd(9/3,12/3) = gcd(3,4) = 1
-
+    int n;
+    cin >> n;
+    vector<ll> phi = totients(n), gcdSum = gcdSums(n);
+    for (int d = 1; d <= n; d++)
+    {
+        if (n % d == 0)
+            cout << "gcd(a, " << n << ") = " << d << " : " << phi[n / d] << nline;
+    }
+    cout << "sum of gcd(a, " << n << ") : " << gcdSum[n] << nline;
     return 0;
 }
\ No newline at end of file
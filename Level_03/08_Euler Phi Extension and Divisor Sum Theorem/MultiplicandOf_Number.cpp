@@ -15,19 +15,207 @@ using namespace std;
     }                      \
     cout << endl;
 
+// 64-bit factorization: deterministic Miller-Rabin and Brent's Pollard rho.
+// Both work in Montgomery form, so the hot loops multiply without any
+// 128-bit division. Valid for odd moduli below 2^63.
+typedef unsigned long long ull;
+struct Montgomery
+{
+    ull n, nInv, r2; // nInv = n^-1 mod 2^64, r2 = 2^128 mod n
+    Montgomery(ull n) : n(n)
+    {
+        nInv = n;
+        for (int i = 0; i < 5; i++)
+            nInv *= 2 - n * nInv;
+        ull r = -n % n;
+        r2 = (unsigned __int128)r * r % n;
+    }
+    ull reduce(unsigned __int128 x) const // x / 2^64 mod n
+    {
+        ull q = (ull)x * nInv;
+        ull m = ((unsigned __int128)q * n) >> 64;
+        ull hi = x >> 64;
+        return hi >= m ? hi - m : hi + n - m;
+    }
+    ull to(ull a) const { return reduce((unsigned __int128)(a % n) * r2); }
+    ull from(ull a) const { return reduce(a); }
+    ull mul(ull a, ull b) const { return reduce((unsigned __int128)a * b); }
+    ull pow(ull a, ull e) const
+    {
+        ull res = to(1);
+        while (e)
+        {
+            if (e & 1)
+                res = mul(res, a);
+            a = mul(a, a);
+            e >>= 1;
+        }
+        return res;
+    }
+};
+bool millerRabin(ull n)
+{
+    if (n < 2)
+        return false;
+    for (ull p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+    {
+        if (n % p == 0)
+            return n == p;
+    }
+    Montgomery mg(n);
+    ull one = mg.to(1), minusOne = mg.to(n - 1);
+    ull d = n - 1;
+    int s = __builtin_ctzll(d);
+    d >>= s;
+    // this witness set is exact for every n < 2^64
+    for (ull a : {2, 325, 9375, 28178, 450775, 9780504, 1795265022})
+    {
+        if (a % n == 0)
+            continue;
+        ull x = mg.pow(mg.to(a), d);
+        if (x == one || x == minusOne)
+            continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; r++)
+        {
+            x = mg.mul(x, x);
+            composite = (x != minusOne);
+        }
+        if (composite)
+            return false;
+    }
+    return true;
+}
+// a non-trivial factor of an odd composite n
+ull pollardRho(ull n)
+{
+    thread_local mt19937_64 rng(20240607);
+    const ull M = 128; // gcd once per M steps
+    Montgomery mg(n);
+    while (true)
+    {
+        ull c = rng() % (n - 1) + 1, y = rng() % n, x = y, ys = y, q = mg.to(1), g = 1;
+        auto f = [&](ull v)
+        {
+            v = mg.mul(v, v) + c;
+            return v >= n ? v - n : v;
+        };
+        for (ull r = 1; g == 1; r <<= 1)
+        {
+            x = y;
+            for (ull i = 0; i < r; i++)
+                y = f(y);
+            for (ull k = 0; k < r && g == 1; k += M)
+            {
+                ys = y;
+                for (ull i = 0; i < min(M, r - k); i++)
+                {
+                    y = f(y);
+                    q = mg.mul(q, x > y ? x - y : y - x);
+                }
+                g = __gcd(q, n);
+            }
+        }
+        if (g == n)
+        {
+            // the batch overshot, redo it one step at a time
+            do
+            {
+                ys = f(ys);
+                g = __gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+        if (g != n)
+            return g;
+    }
+}
+void splitFactor(ull n, vector<ull> &out)
+{
+    if (n == 1)
+        return;
+    if (millerRabin(n))
+    {
+        out.push_back(n);
+        return;
+    }
+    ull d = pollardRho(n);
+    splitFactor(d, out);
+    splitFactor(n / d, out);
+}
+// (prime, exponent) pairs of any n >= 1 in increasing order
+vector<pair<ll, int>> factorize64(ll n)
+{
+    vector<ull> f;
+    for (int p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+    {
+        while (n % p == 0)
+        {
+            f.push_back(p);
+            n /= p;
+        }
+    }
+    splitFactor(n, f);
+    sort(f.begin(), f.end());
+    vector<pair<ll, int>> res;
+    for (ull p : f)
+    {
+        if (!res.empty() && res.back().first == (ll)p)
+            res.back().second++;
+        else
+            res.push_back({(ll)p, 1});
+    }
+    return res;
+}
+// Every value gcd(i, n) for 1 <= i <= n with how often it occurs, as
+// (d, phi(n / d)) pairs sorted by d. The values are exactly the divisors of n,
+// so this costs one factorization plus about d(n) work instead of n gcd calls.
+// The multiplicities add up to n. Empty for n <= 0, as there is no such i.
+vector<pair<ll, ll>> gcdMultiset(ll n)
+{
+    if (n <= 0)
+        return {};
+    // (g, phi(g)) for every divisor g of n, grown one prime power at a time and
+    // kept sorted by merging each new run p^k * (old list) into place
+    auto factors = factorize64(n);
+    size_t total = 1;
+    for (auto [p, e] : factors)
+    {
+        total *= e + 1;
+    }
+    vector<pair<ll, ll>> divs = {{1, 1}};
+    divs.reserve(total);
+    for (auto [p, e] : factors)
+    {
+        vector<pair<ll, ll>> base = divs;
+        ll pk = 1;
+        for (int k = 1; k <= e; k++)
+        {
+            ll phiPk = pk * (p - 1);
+            pk *= p;
+            size_t mid = divs.size();
+            for (auto [g, phiG] : base)
+            {
+                divs.push_back({g * pk, phiG * phiPk});
+            }
+            inplace_merge(divs.begin(), divs.begin() + mid, divs.end());
+        }
+    }
+    // gcd(i, n) = d  <=>  i = d * j with gcd(j, n / d) = 1, so d has phi(n / d) of them
+    reverse(divs.begin(), divs.end());
+    for (auto &[g, phiG] : divs)
+    {
+        g = n / g;
+    }
+    return divs;
+}
 int main()
 {
     Fast;
-    int n;
+    ll n;
     cin >> n;
-    set<int> multiplicand;
-    for (int i = 1; i <= n; i++)
-    {
-        multiplicand.insert(__gcd(i, n));
-    }
-    for (int it : multiplicand)
+    for (auto [d, times] : gcdMultiset(n))
     {
-        cout << it << ' ';
+        cout << d << ' ';
     }
     return 0;
 }
\ No newline at end of file
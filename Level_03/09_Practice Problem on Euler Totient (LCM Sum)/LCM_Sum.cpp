@@ -15,73 +15,256 @@ using namespace std;
     }                      \
     cout << endl;
 
-const int mx = 1e6 + 123;
-bitset<mx> isPrime;
-vector<int> primes;
-void seive(int N)
+// Table of a multiplicative function that is only computed as far as the
+// queries reach. A lookup past the end fills the missing BLOCK-sized blocks
+// by a segmented factorization (base primes up to sqrt of the block end)
+// and keeps them, so the cost follows the largest n asked for so far.
+// primePower(p, e, pk) must return f(p^e), where pk = p^e.
+template <typename F>
+struct LazyMultiplicativeTable
 {
-    isPrime[2] = true;
-    for (int i = 3; i <= N; i += 2)
+    static const int BLOCK = 1 << 16;
+    F primePower;
+    vector<ll> val = {0, 1};
+    vector<int> basePrimes;
+    ll baseLimit = 1;
+    // every operator[] or extend() call is a hit if val already covered n,
+    // a miss otherwise; extensions counts the blocks filled
+    ll hits = 0, misses = 0, extensions = 0;
+
+    LazyMultiplicativeTable(F f) : primePower(f) {}
+    ll operator[](ll n)
     {
-        isPrime[i] = true;
+        extend(n);
+        return val[n];
     }
-    for (int i = 3; i * i <= N; i += 2)
+    // make sure val covers [0, n]. The missing blocks only share the base
+    // primes, so they are filled on all cores straight into val.
+    void extend(ll n)
     {
-        if (isPrime[i])
+        if (n < (ll)val.size())
+        {
+            hits++;
+            return;
+        }
+        misses++;
+        ll target = (n / BLOCK + 1) * BLOCK;
+        ll lo = val.size();
+        if (target <= lo)
+            return;
+        growBasePrimes(sqrtl(target) + 1);
+        val.resize(target);
+        ll blocks = (target - lo + BLOCK - 1) / BLOCK;
+        extensions += blocks;
+        atomic<ll> next(0);
+        auto worker = [&]()
         {
-            for (int j = i * i; j <= N; j += i)
+            for (ll k; (k = next++) < blocks;)
+            {
+                computeBlock(lo + k * BLOCK, min(lo + (k + 1) * BLOCK, target));
+            }
+        };
+        int threads = min<ll>(max(1u, thread::hardware_concurrency()), blocks);
+        vector<thread> pool;
+        for (int t = 1; t < threads; t++)
+        {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto &th : pool)
+        {
+            th.join();
+        }
+    }
+    void growBasePrimes(ll limit)
+    {
+        if (limit <= baseLimit)
+            return;
+        baseLimit = max(limit, 2 * baseLimit);
+        vector<char> isPrime(baseLimit + 1, true);
+        basePrimes.clear();
+        for (ll i = 2; i <= baseLimit; i++)
+        {
+            if (!isPrime[i])
+                continue;
+            basePrimes.push_back(i);
+            for (ll j = i * i; j <= baseLimit; j += i)
             {
                 isPrime[j] = false;
             }
         }
     }
-    primes.push_back(2);
-    for (int i = 3; i <= N; i += 2)
+    // Division-free block fill. For each base prime p, exponent passes over the
+    // multiples of p^2, p^3, ... count the extra powers of p, then one pass over
+    // the multiples of p applies f(p^e) and the factor p^e from small per-prime
+    // tables. What remains of m after all base primes is at most one prime
+    // above sqrt(hi); it is found with a double division, exact below 2^53.
+    void computeBlock(ll lo, ll hi) // fills val[lo, hi), base primes must reach sqrt(hi)
     {
-        if (isPrime[i])
-            primes.push_back(i);
+        int len = hi - lo;
+        vector<ll> f(len, 1), prod(len, 1);
+        vector<uint8_t> extra(len, 0);
+        ll fp[64], pw[64];
+        for (int p : basePrimes)
+        {
+            if (1LL * p * p >= hi)
+                break;
+            int maxE = 1;
+            pw[0] = 1, pw[1] = p;
+            for (ll pj = 1LL * p * p; pj < hi; pj *= p)
+            {
+                pw[++maxE] = pj;
+                for (ll m = (lo + pj - 1) / pj * pj; m < hi; m += pj)
+                {
+                    extra[m - lo]++;
+                }
+                if (pj > hi / p)
+                    break;
+            }
+            for (int e = 1; e <= maxE; e++)
+            {
+                fp[e] = primePower(p, e, pw[e]);
+            }
+            ll *fb = f.data() - lo, *pb = prod.data() - lo;
+            uint8_t *eb = extra.data() - lo;
+            for (ll m = (lo + p - 1) / p * p; m < hi; m += p)
+            {
+                int e = eb[m] + 1;
+                eb[m] = 0;
+                fb[m] *= fp[e];
+                pb[m] *= pw[e];
+            }
+        }
+        vector<ll> rest(len);
+        // a double divide instead of a 64-bit idiv; the int64 <-> double
+        // casts only vectorize with AVX-512DQ, otherwise this stays scalar
+        for (int i = 0; i < len; i++)
+        {
+            rest[i] = (ll)((double)(lo + i) / (double)prod[i] + 0.5);
+        }
+        for (int i = 0; i < len; i++)
+        {
+            if (rest[i] > 1) // one prime factor above sqrt(hi) is left
+                f[i] *= primePower(rest[i], 1, rest[i]);
+        }
+        copy(f.begin(), f.end(), val.begin() + lo);
     }
-}
-const int MX = 1e6 + 123;
-const int limit = 1e6;
-ll Phi[MX], ans[MX];
-void LCM_SUM()
+};
+// ans[n] = sum of d * phi(d) over the divisors d of n. It is multiplicative,
+// with ans(p^e) = 1 + sum_{k=1..e} p^k * p^(k-1) * (p - 1).
+auto lcmOfPrimePower = [](ll p, int e, ll /*pk*/)
 {
-    for (int i = 1; i <= limit; i++)
+    ll res = 1, q = 1;
+    for (int k = 1; k <= e; k++, q *= p)
     {
-        Phi[i] = i;
+        res += q * p * q * (p - 1);
     }
-    for (auto p : primes)
+    return res;
+};
+LazyMultiplicativeTable ans(lcmOfPrimePower);
+typedef unsigned __int128 u128;
+string toString(u128 x)
+{
+    if (x == 0)
+        return "0";
+    string s;
+    while (x)
     {
-        for (int i = p; i <= limit; i += p)
-        {
-            Phi[i] /= p;
-            Phi[i] *= (p - 1);
-        }
+        s += char('0' + x % 10);
+        x /= 10;
     }
-    for (int i = 1; i <= limit; i++)
+    reverse(s.begin(), s.end());
+    return s;
+}
+// L(n) = sum_{i=1..n} lcm(i, n), which passes 2^63 around n = 2e6
+u128 lcmSum(ll n)
+{
+    return (u128)n * (ans[n] + 1) / 2;
+}
+// pre[n] = L(1) + ... + L(n), so the sum of L over [a, b] is one subtraction.
+// The table grows block by block as far as the largest b asked for; an
+// extension only computes the new part. Prefix sums are built in two passes
+// over per-thread chunks (chunk totals, then offsets), like the ans blocks.
+struct LcmSumPrefix
+{
+    vector<u128> pre = {0};
+    void extend(ll n)
     {
-        for (int j = i; j <= limit; j += i)
+        ll lo = pre.size();
+        if (n < lo)
+            return;
+        ans.extend(n);
+        ll hi = ans.val.size(); // fill [lo, hi) to match the ans blocks
+        pre.resize(hi);
+        int threads = min<ll>(max(1u, thread::hardware_concurrency()), (hi - lo) / (1 << 16) + 1);
+        vector<u128> total(threads + 1, 0);
+        auto bounds = [&](int t)
+        { return lo + (hi - lo) * t / threads; };
+        auto run = [&](auto work)
+        {
+            vector<thread> pool;
+            for (int t = 1; t < threads; t++)
+            {
+                pool.emplace_back(work, t);
+            }
+            work(0);
+            for (auto &th : pool)
+            {
+                th.join();
+            }
+        };
+        run([&](int t)
+            {
+            u128 sum = 0;
+            for (ll i = bounds(t); i < bounds(t + 1); i++)
+            {
+                sum += (u128)i * (ans.val[i] + 1) / 2;
+                pre[i] = sum;
+            }
+            total[t + 1] = sum; });
+        total[0] = pre[lo - 1];
+        for (int t = 1; t <= threads; t++)
         {
-            ans[j] += (Phi[i] * i);
+            total[t] += total[t - 1];
         }
+        run([&](int t)
+            {
+            for (ll i = bounds(t); i < bounds(t + 1); i++)
+            {
+                pre[i] += total[t];
+            } });
     }
-}
-int main()
+    u128 operator()(ll a, ll b) // sum of L(a..b), 1 <= a <= b
+    {
+        extend(b);
+        return pre[b] - pre[a - 1];
+    }
+};
+LcmSumPrefix lcmPrefix;
+// Each query is one n, answered with L(n). With --range each query is a
+// pair a b instead, answered with L(a) + ... + L(b).
+int main(int argc, char **argv)
 {
     Fast;
-    seive(limit);
-    LCM_SUM();
+    bool range = argc > 1 && string(argv[1]) == "--range";
     int t;
     cin >> t;
     while (t--)
     {
-        ll n;
-        cin >> n;
-        ll val = ans[n] + 1;
-        val *= n;
-        val /= 2;
-        cout << val << nline;
+        ll a, b;
+        cin >> a;
+        if (range)
+        {
+            cin >> b;
+            if (a < 1 || a > b)
+            {
+                cout << "range must satisfy 1 <= a <= b" << nline;
+                return 1;
+            }
+            cout << toString(lcmPrefix(a, b)) << nline;
+        }
+        else
+            cout << toString(lcmSum(a)) << nline;
     }
     return 0;
 }
\ No newline at end of file
@@ -15,57 +15,261 @@ using namespace std;
     }                      \
     cout << endl;
 
-const int sz = 1e7 + 123;
-bitset<sz> isPrime;
-vector<int> primes;
-void seive(int N)
+// Table of a multiplicative function that is only computed as far as the
+// queries reach. A lookup past the end fills the missing BLOCK-sized blocks
+// by a segmented factorization (base primes up to sqrt of the block end)
+// and keeps them, so the cost follows the largest n asked for so far.
+// primePower(p, e, pk) must return f(p^e), where pk = p^e.
+template <typename F>
+struct LazyMultiplicativeTable
 {
-    isPrime[2] = true;
-    for (int i = 3; i <= N; i += 2)
+    static const int BLOCK = 1 << 16;
+    F primePower;
+    vector<ll> val = {0, 1};
+    vector<int> basePrimes;
+    ll baseLimit = 1;
+    // every operator[] or extend() call is a hit if val already covered n,
+    // a miss otherwise; extensions counts the blocks filled
+    ll hits = 0, misses = 0, extensions = 0;
+
+    LazyMultiplicativeTable(F f) : primePower(f) {}
+    ll operator[](ll n)
+    {
+        extend(n);
+        return val[n];
+    }
+    // make sure val covers [0, n]
+    void extend(ll n)
     {
-        isPrime[i] = true;
+        if (n < (ll)val.size())
+        {
+            hits++;
+            return;
+        }
+        misses++;
+        ll target = (n / BLOCK + 1) * BLOCK;
+        while ((ll)val.size() < target)
+        {
+            computeBlock(val.size(), min((ll)val.size() + BLOCK, target));
+        }
     }
-    for (int i = 3; i * i <= N; i += 2)
+    void growBasePrimes(ll limit)
     {
-        if (isPrime[i])
+        if (limit <= baseLimit)
+            return;
+        baseLimit = max(limit, 2 * baseLimit);
+        vector<char> isPrime(baseLimit + 1, true);
+        basePrimes.clear();
+        for (ll i = 2; i <= baseLimit; i++)
         {
-            for (int j = i * i; j <= N; j += i)
+            if (!isPrime[i])
+                continue;
+            basePrimes.push_back(i);
+            for (ll j = i * i; j <= baseLimit; j += i)
             {
                 isPrime[j] = false;
             }
         }
     }
-    primes.push_back(2);
-    for (int i = 3; i <= N; i += 2)
+    // Division-free block fill. For each base prime p, exponent passes over the
+    // multiples of p^2, p^3, ... count the extra powers of p, then one pass over
+    // the multiples of p applies f(p^e) and the factor p^e from small per-prime
+    // tables. What remains of m after all base primes is at most one prime
+    // above sqrt(hi); it is found with a double division, exact below 2^53.
+    void computeBlock(ll lo, ll hi) // fills [lo, hi), lo == val.size()
+    {
+        extensions++;
+        growBasePrimes(sqrtl(hi) + 1);
+        int len = hi - lo;
+        vector<ll> f(len, 1), prod(len, 1);
+        vector<uint8_t> extra(len, 0);
+        ll fp[64], pw[64];
+        for (int p : basePrimes)
+        {
+            if (1LL * p * p >= hi)
+                break;
+            int maxE = 1;
+            pw[0] = 1, pw[1] = p;
+            for (ll pj = 1LL * p * p; pj < hi; pj *= p)
+            {
+                pw[++maxE] = pj;
+                for (ll m = (lo + pj - 1) / pj * pj; m < hi; m += pj)
+                {
+                    extra[m - lo]++;
+                }
+                if (pj > hi / p)
+                    break;
+            }
+            for (int e = 1; e <= maxE; e++)
+            {
+                fp[e] = primePower(p, e, pw[e]);
+            }
+            ll *fb = f.data() - lo, *pb = prod.data() - lo;
+            uint8_t *eb = extra.data() - lo;
+            for (ll m = (lo + p - 1) / p * p; m < hi; m += p)
+            {
+                int e = eb[m] + 1;
+                eb[m] = 0;
+                fb[m] *= fp[e];
+                pb[m] *= pw[e];
+            }
+        }
+        vector<ll> rest(len);
+        // a double divide instead of a 64-bit idiv; the int64 <-> double
+        // casts only vectorize with AVX-512DQ, otherwise this stays scalar
+        for (int i = 0; i < len; i++)
+        {
+            rest[i] = (ll)((double)(lo + i) / (double)prod[i] + 0.5);
+        }
+        for (int i = 0; i < len; i++)
+        {
+            if (rest[i] > 1) // one prime factor above sqrt(hi) is left
+                f[i] *= primePower(rest[i], 1, rest[i]);
+        }
+        val.insert(val.end(), f.begin(), f.end());
+    }
+};
+auto phiOfPrimePower = [](ll p, int /*e*/, ll pk)
+{ return pk - pk / p; };
+LazyMultiplicativeTable Phi(phiOfPrimePower);
+// phiSqPrefix[i] = phi(1)^2 + ... + phi(i)^2, grown together with Phi
+vector<unsigned ll> phiSqPrefix = {0};
+unsigned ll PhiSqPrefix(int n)
+{
+    if (n >= (int)phiSqPrefix.size())
     {
-        if (isPrime[i])
-            primes.push_back(i);
+        Phi.extend(n);
+        for (int i = phiSqPrefix.size(); i <= n; i++)
+        {
+            unsigned ll p = Phi.val[i];
+            phiSqPrefix.push_back(phiSqPrefix.back() + p * p);
+        }
     }
+    return phiSqPrefix[n];
 }
-
-const int mx = 5e6 + 123;
-unsigned ll Phi[mx];
-int main()
+// Du's sieve for the totient summatory functions past the table:
+//   sum_{d <= n} Phi(n / d) = n (n + 1) / 2                        (phi * 1 = id)
+//   sum_{d <= n} d * PhiId(n / d) = n (n + 1) (2n + 1) / 6        ((phi.id) * id = id^2)
+// Values up to duLimit come from prefix sums of the Phi table, larger
+// arguments are memoized, and the d-sum runs over blocks of equal n / d.
+// Both sums share the same blocks, so they are computed together.
+// sum phi^2 has no such easy convolution partner, so it stays table-only.
+// The table is sized to n^(2/3) of the largest query, the usual balance
+// between sieving and the memoized recursion. sum phi(i) stays below 2^63
+// there, but sum i * phi(i) ~ 0.2 i^3 does not fit in 64 bits past ~4e6, so
+// it is kept as a u128 checkpoint every 64 entries plus a 64-bit offset from
+// it: 8 bytes per entry, the same as phiPrefix.
+typedef unsigned __int128 u128;
+const ll SUM_MAX = 1e12; // sum i * phi(i) ~ 0.2 n^3 stays inside 128 bits
+const ll DU_MAX = 1e8;   // SUM_MAX^(2/3)
+ll duLimit = 0;
+vector<ll> phiPrefix;          // sum of phi(i), i <= duLimit
+vector<u128> phiIdBase;        // sum of i * phi(i), i < 64k
+vector<unsigned ll> phiIdLow;  // sum of i * phi(i), 64 * (i / 64) <= i' <= i
+u128 phiIdPrefix(ll i)
 {
-    Fast;
-    int limit = 5e6;
-    seive(limit);
-    for (int i = 1; i <= limit; i++)
+    return phiIdBase[i >> 6] + phiIdLow[i];
+}
+unordered_map<ll, pair<u128, u128>> phiMemo;
+// The prefix sums are taken in place over Phi.val and moved out, so the
+// peak is two 8-byte tables; Phi starts over empty afterwards.
+void buildDuTables(ll maxN)
+{
+    duLimit = min<ll>(DU_MAX, max<ll>(pow((double)maxN, 2.0 / 3), 1));
+    Phi.extend(duLimit);
+    Phi.val.resize(duLimit + 1);
+    phiIdBase.assign(duLimit / 64 + 1, 0);
+    phiIdLow.assign(duLimit + 1, 0);
+    u128 id = 0;
+    ll sum = 0;
+    for (ll i = 0; i <= duLimit; i++)
     {
-        Phi[i] = i;
+        if (i % 64 == 0)
+            phiIdBase[i >> 6] = id;
+        id += (u128)i * Phi.val[i];
+        phiIdLow[i] = id - phiIdBase[i >> 6];
+        sum += Phi.val[i];
+        Phi.val[i] = sum;
     }
-    for (auto p : primes)
+    phiPrefix = move(Phi.val);
+    Phi.val = {0, 1};
+    phiMemo.clear();
+}
+u128 sumRange(ll l, ll r) // l + (l + 1) + ... + r
+{
+    return (u128)(l + r) * (r - l + 1) / 2;
+}
+// {phi(1) + ... + phi(n), 1 * phi(1) + ... + n * phi(n)} for n <= SUM_MAX
+pair<u128, u128> PhiSums(ll n)
+{
+    if (phiPrefix.empty())
+        buildDuTables(n);
+    if (n <= duLimit)
+        return {phiPrefix[n], phiIdPrefix(n)};
+    auto it = phiMemo.find(n);
+    if (it != phiMemo.end())
+        return it->second;
+    u128 sum = sumRange(1, n);
+    u128 sumId = (u128)n * (n + 1) / 2 * (2 * n + 1) / 3;
+    for (ll l = 2, r; l <= n; l = r + 1)
     {
-        for (int i = p; i <= limit; i += p)
+        ll q = n / l;
+        r = n / q;
+        auto sub = q <= duLimit ? make_pair((u128)phiPrefix[q], phiIdPrefix(q)) : PhiSums(q);
+        sum -= (u128)(r - l + 1) * sub.first;
+        sumId -= sumRange(l, r) * sub.second;
+    }
+    return phiMemo[n] = {sum, sumId};
+}
+u128 PhiSum(ll n)
+{
+    return PhiSums(n).first;
+}
+u128 PhiIdSum(ll n)
+{
+    return PhiSums(n).second;
+}
+string toString(u128 x)
+{
+    if (x == 0)
+        return "0";
+    string s;
+    while (x)
+    {
+        s += char('0' + x % 10);
+        x /= 10;
+    }
+    reverse(s.begin(), s.end());
+    return s;
+}
+// --sum: t queries n <= SUM_MAX, each answered with PhiSum(n) and PhiIdSum(n).
+// All queries are read first so the Du table can be sized for the largest.
+int sumQueries()
+{
+    int t;
+    cin >> t;
+    vector<ll> q(t);
+    for (ll &n : q)
+    {
+        cin >> n;
+        if (n < 0 || n > SUM_MAX)
         {
-            Phi[i] /= p;
-            Phi[i] *= (p - 1);
+            cout << "n must be between 0 and " << SUM_MAX << nline;
+            return 1;
         }
     }
-    for (int i = 1; i <= limit; i++)
+    buildDuTables(q.empty() ? 1 : *max_element(q.begin(), q.end()));
+    for (int test = 1; test <= t; test++)
     {
-        Phi[i] = Phi[i] * Phi[i] + Phi[i - 1];
+        cout << "Case " << test << ": " << toString(PhiSum(q[test - 1])) << ' ' << toString(PhiIdSum(q[test - 1])) << nline;
     }
+    return 0;
+}
+int main(int argc, char **argv)
+{
+    Fast;
+    if (argc > 1 && string(argv[1]) == "--sum")
+        return sumQueries();
     // for (int i = 2; i <= 6; i++)
     // {
     //     cout << Phi[i] << ' ';
@@ -76,7 +280,7 @@ int main()
     {
         int a, b;
         cin >> a >> b;
-        cout << "Case " << test << ": " << Phi[b] - Phi[a - 1] << nline;
+        cout << "Case " << test << ": " << PhiSqPrefix(b) - PhiSqPrefix(a - 1) << nline;
     }
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include <bits/stdc++.h>
+using namespace std;
+#define ll long long int
+#define nline char(10)
+#define Fast                          \
+    ios_base::sync_with_stdio(false); \
+    cin.tie(0);                       \
+    cout.tie(0);
+#define Yes cout << "YES\n"
+#define No cout << "NO\n"
+#define print(v)           \
+    for (auto &it : v)     \
+    {                      \
+        cout << it << ' '; \
+    }                      \
+    cout << endl;
+
+// Compares ways of filling phi[0..N]:
+//   divide   the classic sweep, phi[m] /= p; phi[m] *= p - 1 for every prime p | m
+//   linear   linear sieve, phi(i p) from phi(i) with no division at all
+//   blocks   the BLOCK-sized fill of LazyMultiplicativeTable, old version that
+//            strips powers of p with r % p and r /= p
+//   strides  the current division-free fill: exponent passes over p^k strides
+//            plus one double division per element for the large prime
+const int BLOCK = 1 << 16;
+vector<ll> divideSweep(int n)
+{
+    vector<ll> phi(n + 1);
+    iota(phi.begin(), phi.end(), 0);
+    for (int p = 2; p <= n; p++)
+    {
+        if (phi[p] != p)
+            continue;
+        for (int m = p; m <= n; m += p)
+        {
+            phi[m] /= p;
+            phi[m] *= p - 1;
+        }
+    }
+    return phi;
+}
+vector<ll> linearSweep(int n)
+{
+    vector<ll> phi(n + 1, 0);
+    vector<int> primes;
+    phi[1] = 1;
+    for (int i = 2; i <= n; i++)
+    {
+        if (phi[i] == 0)
+        {
+            phi[i] = i - 1;
+            primes.push_back(i);
+        }
+        for (int p : primes)
+        {
+            if (1LL * i * p > n)
+                break;
+            if (i % p == 0)
+            {
+                phi[i * p] = phi[i] * p;
+                break;
+            }
+            phi[i * p] = phi[i] * (p - 1);
+        }
+    }
+    return phi;
+}
+vector<int> primesUpTo(int n)
+{
+    vector<char> composite(n + 1, false);
+    vector<int> primes;
+    for (ll i = 2; i <= n; i++)
+    {
+        if (composite[i])
+            continue;
+        primes.push_back(i);
+        for (ll j = i * i; j <= n; j += i)
+        {
+            composite[j] = true;
+        }
+    }
+    return primes;
+}
+void divideBlock(vector<ll> &phi, const vector<int> &basePrimes, ll lo, ll hi)
+{
+    vector<ll> rem(hi - lo), f(hi - lo, 1);
+    iota(rem.begin(), rem.end(), lo);
+    for (int p : basePrimes)
+    {
+        if (1LL * p * p >= hi)
+            break;
+        for (ll m = (lo + p - 1) / p * p; m < hi; m += p)
+        {
+            ll &r = rem[m - lo];
+            ll pk = 1;
+            while (r % p == 0)
+            {
+                r /= p;
+                pk *= p;
+            }
+            f[m - lo] *= pk - pk / p;
+        }
+    }
+    for (ll i = 0; i < hi - lo; i++)
+    {
+        if (rem[i] > 1)
+            f[i] *= rem[i] - 1;
+    }
+    phi.insert(phi.end(), f.begin(), f.end());
+}
+void strideBlock(vector<ll> &phi, const vector<int> &basePrimes, ll lo, ll hi)
+{
+    int len = hi - lo;
+    vector<ll> f(len, 1), prod(len, 1);
+    vector<uint8_t> extra(len, 0);
+    ll fp[64], pw[64];
+    for (int p : basePrimes)
+    {
+        if (1LL * p * p >= hi)
+            break;
+        int maxE = 1;
+        pw[0] = 1, pw[1] = p;
+        for (ll pj = 1LL * p * p; pj < hi; pj *= p)
+        {
+            pw[++maxE] = pj;
+            for (ll m = (lo + pj - 1) / pj * pj; m < hi; m += pj)
+            {
+                extra[m - lo]++;
+            }
+            if (pj > hi / p)
+                break;
+        }
+        for (int e = 1; e <= maxE; e++)
+        {
+            fp[e] = pw[e] - pw[e - 1];
+        }
+        ll *fb = f.data() - lo, *pb = prod.data() - lo;
+        uint8_t *eb = extra.data() - lo;
+        for (ll m = (lo + p - 1) / p * p; m < hi; m += p)
+        {
+            int e = eb[m] + 1;
+            eb[m] = 0;
+            fb[m] *= fp[e];
+            pb[m] *= pw[e];
+        }
+    }
+    vector<ll> rest(len);
+    for (int i = 0; i < len; i++)
+    {
+        rest[i] = (ll)((double)(lo + i) / (double)prod[i] + 0.5);
+    }
+    for (int i = 0; i < len; i++)
+    {
+        if (rest[i] > 1)
+            f[i] *= rest[i] - 1;
+    }
+    phi.insert(phi.end(), f.begin(), f.end());
+}
+template <typename Fill>
+vector<ll> blockSweep(int n, Fill fill)
+{
+    vector<ll> phi = {0, 1};
+    vector<int> basePrimes = primesUpTo(sqrtl(n + BLOCK) + 1);
+    while ((ll)phi.size() <= n)
+    {
+        fill(phi, basePrimes, phi.size(), min<ll>(phi.size() + BLOCK, n + 1));
+    }
+    return phi;
+}
+int main()
+{
+    Fast;
+    for (int N : {(int)5e6, (int)5e7})
+    {
+        vector<pair<string, function<vector<ll>(int)>>> ways = {
+            {"divide ", divideSweep},
+            {"linear ", linearSweep},
+            {"blocks ", [](int n)
+             { return blockSweep(n, divideBlock); }},
+            {"strides", [](int n)
+             { return blockSweep(n, strideBlock); }}};
+        double base = 0;
+        vector<ll> expect;
+        for (auto &[name, sweep] : ways)
+        {
+            auto start = chrono::steady_clock::now();
+            vector<ll> phi = sweep(N);
+            double sec = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            if (expect.empty())
+                base = sec, expect = phi;
+            bool ok = phi == expect;
+            cout << "N = " << N << "  " << name << "  time = " << fixed << setprecision(3) << sec << "s"
+                 << "  speedup = " << setprecision(2) << base / sec << "x" << (ok ? "" : "  MISMATCH") << nline;
+        }
+    }
+    return 0;
+}
@@ -15,64 +15,477 @@ using namespace std;
     }                      \
     cout << endl;
 
-const int mx = 1e6 + 123;
-bitset<mx> isPrime;
-vector<int> primes;
-void seive(int N)
+// Table of a multiplicative function that is only computed as far as the
+// queries reach. A lookup past the end fills the missing BLOCK-sized blocks
+// by a segmented factorization (base primes up to sqrt of the block end)
+// and keeps them, so the cost follows the largest n asked for so far.
+// primePower(p, e, pk) must return f(p^e), where pk = p^e.
+template <typename F>
+struct LazyMultiplicativeTable
 {
-    isPrime[2] = true;
-    for (int i = 3; i <= N; i += 2)
+    static const int BLOCK = 1 << 16;
+    F primePower;
+    vector<ll> val = {0, 1};
+    vector<int> basePrimes;
+    ll baseLimit = 1;
+    // every operator[] or extend() call is a hit if val already covered n,
+    // a miss otherwise; extensions counts the blocks filled
+    ll hits = 0, misses = 0, extensions = 0;
+
+    LazyMultiplicativeTable(F f) : primePower(f) {}
+    ll operator[](ll n)
+    {
+        extend(n);
+        return val[n];
+    }
+    // make sure val covers [0, n]
+    void extend(ll n)
     {
-        isPrime[i] = true;
+        if (n < (ll)val.size())
+        {
+            hits++;
+            return;
+        }
+        misses++;
+        ll target = (n / BLOCK + 1) * BLOCK;
+        while ((ll)val.size() < target)
+        {
+            computeBlock(val.size(), min((ll)val.size() + BLOCK, target));
+        }
     }
-    for (int i = 3; i * i <= N; i += 2)
+    void growBasePrimes(ll limit)
     {
-        if (isPrime[i])
+        if (limit <= baseLimit)
+            return;
+        baseLimit = max(limit, 2 * baseLimit);
+        vector<char> isPrime(baseLimit + 1, true);
+        basePrimes.clear();
+        for (ll i = 2; i <= baseLimit; i++)
         {
-            for (int j = i * i; j <= N; j += i)
+            if (!isPrime[i])
+                continue;
+            basePrimes.push_back(i);
+            for (ll j = i * i; j <= baseLimit; j += i)
             {
                 isPrime[j] = false;
             }
         }
     }
-    primes.push_back(2);
-    for (int i = 3; i <= N; i += 2)
+    // Division-free block fill. For each base prime p, exponent passes over the
+    // multiples of p^2, p^3, ... count the extra powers of p, then one pass over
+    // the multiples of p applies f(p^e) and the factor p^e from small per-prime
+    // tables. What remains of m after all base primes is at most one prime
+    // above sqrt(hi); it is found with a double division, exact below 2^53.
+    void computeBlock(ll lo, ll hi) // fills [lo, hi), lo == val.size()
+    {
+        extensions++;
+        growBasePrimes(sqrtl(hi) + 1);
+        int len = hi - lo;
+        vector<ll> f(len, 1), prod(len, 1);
+        vector<uint8_t> extra(len, 0);
+        ll fp[64], pw[64];
+        for (int p : basePrimes)
+        {
+            if (1LL * p * p >= hi)
+                break;
+            int maxE = 1;
+            pw[0] = 1, pw[1] = p;
+            for (ll pj = 1LL * p * p; pj < hi; pj *= p)
+            {
+                pw[++maxE] = pj;
+                for (ll m = (lo + pj - 1) / pj * pj; m < hi; m += pj)
+                {
+                    extra[m - lo]++;
+                }
+                if (pj > hi / p)
+                    break;
+            }
+            for (int e = 1; e <= maxE; e++)
+            {
+                fp[e] = primePower(p, e, pw[e]);
+            }
+            ll *fb = f.data() - lo, *pb = prod.data() - lo;
+            uint8_t *eb = extra.data() - lo;
+            for (ll m = (lo + p - 1) / p * p; m < hi; m += p)
+            {
+                int e = eb[m] + 1;
+                eb[m] = 0;
+                fb[m] *= fp[e];
+                pb[m] *= pw[e];
+            }
+        }
+        vector<ll> rest(len);
+        // a double divide instead of a 64-bit idiv; the int64 <-> double
+        // casts only vectorize with AVX-512DQ, otherwise this stays scalar
+        for (int i = 0; i < len; i++)
+        {
+            rest[i] = (ll)((double)(lo + i) / (double)prod[i] + 0.5);
+        }
+        for (int i = 0; i < len; i++)
+        {
+            if (rest[i] > 1) // one prime factor above sqrt(hi) is left
+                f[i] *= primePower(rest[i], 1, rest[i]);
+        }
+        val.insert(val.end(), f.begin(), f.end());
+    }
+};
+auto phiOfPrimePower = [](ll p, int /*e*/, ll pk)
+{ return pk - pk / p; };
+LazyMultiplicativeTable phi(phiOfPrimePower);
+// 64-bit factorization: deterministic Miller-Rabin and Brent's Pollard rho.
+// Both work in Montgomery form, so the hot loops multiply without any
+// 128-bit division. Valid for odd moduli below 2^63.
+typedef unsigned long long ull;
+struct Montgomery
+{
+    ull n, nInv, r2; // nInv = n^-1 mod 2^64, r2 = 2^128 mod n
+    Montgomery(ull n) : n(n)
+    {
+        nInv = n;
+        for (int i = 0; i < 5; i++)
+            nInv *= 2 - n * nInv;
+        ull r = -n % n;
+        r2 = (unsigned __int128)r * r % n;
+    }
+    ull reduce(unsigned __int128 x) const // x / 2^64 mod n
+    {
+        ull q = (ull)x * nInv;
+        ull m = ((unsigned __int128)q * n) >> 64;
+        ull hi = x >> 64;
+        return hi >= m ? hi - m : hi + n - m;
+    }
+    ull to(ull a) const { return reduce((unsigned __int128)(a % n) * r2); }
+    ull from(ull a) const { return reduce(a); }
+    ull mul(ull a, ull b) const { return reduce((unsigned __int128)a * b); }
+    ull pow(ull a, ull e) const
+    {
+        ull res = to(1);
+        while (e)
+        {
+            if (e & 1)
+                res = mul(res, a);
+            a = mul(a, a);
+            e >>= 1;
+        }
+        return res;
+    }
+};
+bool millerRabin(ull n)
+{
+    if (n < 2)
+        return false;
+    for (ull p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+    {
+        if (n % p == 0)
+            return n == p;
+    }
+    Montgomery mg(n);
+    ull one = mg.to(1), minusOne = mg.to(n - 1);
+    ull d = n - 1;
+    int s = __builtin_ctzll(d);
+    d >>= s;
+    // this witness set is exact for every n < 2^64
+    for (ull a : {2, 325, 9375, 28178, 450775, 9780504, 1795265022})
+    {
+        if (a % n == 0)
+            continue;
+        ull x = mg.pow(mg.to(a), d);
+        if (x == one || x == minusOne)
+            continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; r++)
+        {
+            x = mg.mul(x, x);
+            composite = (x != minusOne);
+        }
+        if (composite)
+            return false;
+    }
+    return true;
+}
+// a non-trivial factor of an odd composite n
+ull pollardRho(ull n)
+{
+    thread_local mt19937_64 rng(20240607);
+    const ull M = 128; // gcd once per M steps
+    Montgomery mg(n);
+    while (true)
+    {
+        ull c = rng() % (n - 1) + 1, y = rng() % n, x = y, ys = y, q = mg.to(1), g = 1;
+        auto f = [&](ull v)
+        {
+            v = mg.mul(v, v) + c;
+            return v >= n ? v - n : v;
+        };
+        for (ull r = 1; g == 1; r <<= 1)
+        {
+            x = y;
+            for (ull i = 0; i < r; i++)
+                y = f(y);
+            for (ull k = 0; k < r && g == 1; k += M)
+            {
+                ys = y;
+                for (ull i = 0; i < min(M, r - k); i++)
+                {
+                    y = f(y);
+                    q = mg.mul(q, x > y ? x - y : y - x);
+                }
+                g = __gcd(q, n);
+            }
+        }
+        if (g == n)
+        {
+            // the batch overshot, redo it one step at a time
+            do
+            {
+                ys = f(ys);
+                g = __gcd(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+        if (g != n)
+            return g;
+    }
+}
+void splitFactor(ull n, vector<ull> &out)
+{
+    if (n == 1)
+        return;
+    if (millerRabin(n))
+    {
+        out.push_back(n);
+        return;
+    }
+    ull d = pollardRho(n);
+    splitFactor(d, out);
+    splitFactor(n / d, out);
+}
+// (prime, exponent) pairs of any n >= 1 in increasing order
+vector<pair<ll, int>> factorize64(ll n)
+{
+    vector<ull> f;
+    for (int p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+    {
+        while (n % p == 0)
+        {
+            f.push_back(p);
+            n /= p;
+        }
+    }
+    splitFactor(n, f);
+    sort(f.begin(), f.end());
+    vector<pair<ll, int>> res;
+    for (ull p : f)
+    {
+        if (!res.empty() && res.back().first == (ll)p)
+            res.back().second++;
+        else
+            res.push_back({(ll)p, 1});
+    }
+    return res;
+}
+typedef unsigned __int128 u128;
+// Inputs up to TABLE_LIMIT read phi from the lazy table, larger ones
+// (up to ~1e18) factorize n instead. Sums of numbers below n reach n^2 / 2,
+// so everything is done in 128 bits.
+const ll TABLE_LIMIT = 1e7;
+ll Phi(ll n)
+{
+    if (n <= TABLE_LIMIT)
+        return phi[n];
+    ll res = n;
+    for (auto [p, e] : factorize64(n))
+    {
+        res -= res / p;
+    }
+    return res;
+}
+// sum of the i in [1, n] with gcd(i, n) = 1; they pair up as i and n - i,
+// except for n = 1 where i = 1 is its own (and only) partner
+u128 coprimeSum(ll n, ll phiN)
+{
+    if (n == 1)
+        return 1;
+    return (u128)n * phiN / 2;
+}
+// sum of the i in [1, n - 1] with gcd(i, n) > 1
+u128 nonCoprimeSum(ll n, ll phiN)
+{
+    if (n == 1)
+        return 0;
+    return (u128)n * (n - 1) / 2 - coprimeSum(n, phiN);
+}
+// Batch mode: t followed by t values of n, read with one fread. With --binary
+// the input is a uint64 count and uint64 values, and each answer is written
+// as a raw 16-byte unsigned __int128. --coprime answers the coprime sum
+// instead of the non-coprime one.
+vector<char> readAll()
+{
+    vector<char> buf;
+    char chunk[1 << 16];
+    size_t got;
+    while ((got = fread(chunk, 1, sizeof(chunk), stdin)) > 0)
     {
-        if (isPrime[i])
-            primes.push_back(i);
+        buf.insert(buf.end(), chunk, chunk + got);
     }
+    return buf;
 }
-int phi[mx];
-int main()
+// factorize64 works in signed 64-bit, so larger queries are refused
+const ull MAX_N = LLONG_MAX;
+vector<ull> readQueries(bool binary)
 {
-    Fast;
-    int limit = 1e6;
-    seive(limit);
-    for (int i = 1; i <= limit; i++)
+    vector<char> buf = readAll();
+    vector<ull> q;
+    if (binary)
+    {
+        ull t = 0;
+        if (buf.size() >= 8)
+            memcpy(&t, buf.data(), 8);
+        t = min<ull>(t, (buf.size() - min<size_t>(buf.size(), 8)) / 8);
+        q.resize(t);
+        if (t)
+            memcpy(q.data(), buf.data() + 8, t * 8);
+        return q;
+    }
+    size_t pos = 0;
+    auto next = [&](ull &x)
+    {
+        while (pos < buf.size() && (buf[pos] < '0' || buf[pos] > '9'))
+            pos++;
+        if (pos == buf.size())
+            return false;
+        bool negative = pos > 0 && buf[pos - 1] == '-';
+        x = 0;
+        while (pos < buf.size() && buf[pos] >= '0' && buf[pos] <= '9')
+        {
+            // anything past MAX_N is clamped to MAX_N + 1 and rejected in main
+            x = x > MAX_N / 10 ? MAX_N + 1 : x * 10 + (buf[pos] - '0');
+            pos++;
+        }
+        if (negative)
+            x = MAX_N + 1; // no valid query is negative
+        return true;
+    };
+    ull t = 0, x;
+    next(t);
+    q.reserve(min<ull>(t, buf.size() / 2 + 1));
+    while (q.size() < t && next(x))
     {
-        phi[i] = i;
+        q.push_back(x);
     }
-    for (auto p : primes)
+    return q;
+}
+void appendU128(string &out, u128 x)
+{
+    char tmp[40];
+    char *end = tmp;
+    if (x >> 64)
     {
-        for (int i = p; i <= limit; i += p)
+        // at most 39 digits: print the high part, then 19 zero-padded digits
+        const ull P19 = 10000000000000000000ULL;
+        end = to_chars(tmp, tmp + sizeof(tmp), (ull)(x / P19)).ptr;
+        ull low = x % P19;
+        for (int k = 18; k >= 0; k--, low /= 10)
         {
-            phi[i] /= p;
-            phi[i] *= (p - 1);
+            end[k] = '0' + low % 10;
         }
+        end += 19;
     }
+    else
+        end = to_chars(tmp, tmp + sizeof(tmp), (ull)x).ptr;
+    out.append(tmp, end);
+}
+void writeAnswers(const vector<u128> &ans, bool binary)
+{
+    if (binary)
+    {
+        fwrite(ans.data(), 16, ans.size(), stdout);
+        return;
+    }
+    string out;
+    out.reserve(ans.size() * 12);
+    for (u128 v : ans)
+    {
+        appendU128(out, v);
+        out.push_back(nline);
+    }
+    fwrite(out.data(), 1, out.size(), stdout);
+}
+// Run solve(i) for every index in idx on all cores, chunk indices at a time
+template <typename F>
+void parallelFor(const vector<int> &idx, size_t chunk, F solve)
+{
+    atomic<size_t> pos(0);
+    auto worker = [&]()
+    {
+        for (size_t s; (s = pos.fetch_add(chunk)) < idx.size();)
+        {
+            for (size_t k = s; k < min(idx.size(), s + chunk); k++)
+            {
+                solve(idx[k]);
+            }
+        }
+    };
+    int threads = max(1u, thread::hardware_concurrency());
+    threads = min<size_t>(threads, idx.size() / chunk + 1);
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++)
+    {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto &th : pool)
+    {
+        th.join();
+    }
+}
+// Table-range queries are one lookup each once the table covers the largest
+// of them; the rest go through Pollard rho in small chunks.
+vector<u128> solveBatch(const vector<ull> &q, bool coprime)
+{
+    vector<u128> ans(q.size());
+    vector<int> cheap, heavy;
+    ll tableMax = 0;
+    for (int i = 0; i < (int)q.size(); i++)
+    {
+        if (q[i] <= (ull)TABLE_LIMIT)
+        {
+            cheap.push_back(i);
+            tableMax = max(tableMax, (ll)q[i]);
+        }
+        else
+            heavy.push_back(i);
+    }
+    phi.extend(tableMax); // grow once here so the workers only read
+    auto solve = [&](int i, ll phiN)
+    {
+        ll n = q[i];
+        ans[i] = coprime ? coprimeSum(n, phiN) : nonCoprimeSum(n, phiN);
+    };
+    parallelFor(cheap, 1 << 14, [&](int i)
+                { solve(i, phi.val[q[i]]); });
+    parallelFor(heavy, 16, [&](int i)
+                { solve(i, Phi(q[i])); });
+    return ans;
+}
+int main(int argc, char **argv)
+{
+    bool binary = false, coprime = false;
+    for (int i = 1; i < argc; i++)
+    {
+        binary |= string(argv[i]) == "--binary";
+        coprime |= string(argv[i]) == "--coprime";
+    }
+    vector<ull> q = readQueries(binary);
+    if (any_of(q.begin(), q.end(), [](ull x)
+               { return x > MAX_N; }))
+    {
+        cout << "n must be between 0 and " << MAX_N << nline;
+        return 1;
+    }
+    writeAnswers(solveBatch(q, coprime), binary);
     // for (int i = 1; i <= 14; i++)
     // {
     //     cout << phi[i] << ' ';
     // }
-    int t;
-    cin >> t;
-    while (t--)
-    {
-        ll n;
-        cin >> n;
-        ll phi_sum = (1LL * phi[n] * n) / 2;
-        ll tot_sum = (1LL * n * (n - 1)) / 2;
-        cout << tot_sum - phi_sum << nline;
-    }
     return 0;
 }
\ No newline at end of file